@@ -0,0 +1,95 @@
+// Dispatcher hot-path benchmarks: dispatch->process_event round trip,
+// multi-producer throughput for both queue modes, and event construction
+// cost (heap vs pooled). Run these before and after touching anything on
+// the dispatch path.
+
+#include <event_adapter/event_dispatcher.hpp>
+#include <event_adapter/event_pool.hpp>
+#include <benchmark/benchmark.h>
+#include <atomic>
+
+using namespace event_adapter;
+
+namespace {
+
+struct CounterStateMachine {
+    std::atomic<std::uint64_t> processed{0};
+};
+
+using Dispatcher = EventDispatcher<CounterStateMachine>;
+
+Dispatcher* g_dispatcher = nullptr;
+CounterStateMachine* g_sm = nullptr;
+
+void setup_dispatcher(Dispatcher::QueueMode mode) {
+    g_sm = new CounterStateMachine();
+    g_dispatcher = new Dispatcher(*g_sm, mode);
+    g_dispatcher->register_event_processor<DataUpdateEvent>(
+        [](const DataUpdateEvent&, CounterStateMachine& sm) {
+            sm.processed.fetch_add(1, std::memory_order_relaxed);
+        });
+    g_dispatcher->start();
+}
+
+void teardown_dispatcher() {
+    g_dispatcher->stop();
+    delete g_dispatcher;
+    delete g_sm;
+    g_dispatcher = nullptr;
+    g_sm = nullptr;
+}
+
+// Throughput with 1..32 concurrent producer threads. Arg(0) = locked
+// queue, Arg(1) = lock-free MPSC ring.
+void BM_DispatchThroughput(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        setup_dispatcher(state.range(0) ? Dispatcher::QueueMode::LockFree
+                                        : Dispatcher::QueueMode::Locked);
+    }
+    for (auto _ : state) {
+        g_dispatcher->dispatch(make_event<DataUpdateEvent>("bench", "key", 1.0, 0.0));
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        teardown_dispatcher();
+    }
+}
+BENCHMARK(BM_DispatchThroughput)
+    ->Arg(0)->Arg(1)
+    ->Threads(1)->Threads(4)->Threads(8)->Threads(16)->Threads(32)
+    ->UseRealTime();
+
+// Single-event round-trip latency: dispatch, then spin until the
+// processor thread has consumed it.
+void BM_DispatchRoundTrip(benchmark::State& state) {
+    setup_dispatcher(state.range(0) ? Dispatcher::QueueMode::LockFree
+                                    : Dispatcher::QueueMode::Locked);
+    std::uint64_t expected = 0;
+    for (auto _ : state) {
+        g_dispatcher->dispatch(make_event<DataUpdateEvent>("bench", "key", 1.0, 0.0));
+        ++expected;
+        while (g_sm->processed.load(std::memory_order_relaxed) < expected) {
+        }
+    }
+    teardown_dispatcher();
+}
+BENCHMARK(BM_DispatchRoundTrip)->Arg(0)->Arg(1);
+
+void BM_MakeEvent(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(make_event<DataUpdateEvent>("bench", "key", 1.0, 0.0));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MakeEvent);
+
+void BM_MakePooledEvent(benchmark::State& state) {
+    auto pool = EventPool<DataUpdateEvent>::create();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(make_pooled_event(*pool, "bench", "key", 1.0, 0.0));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MakePooledEvent);
+
+} // namespace
@@ -0,0 +1,73 @@
+// EventPipeline filter-chain cost at varying depth and
+// DataSourceAdapter::emit_event fan-out to N subscribed handlers.
+
+#include <event_adapter/event_filter.hpp>
+#include <event_adapter/data_source_adapter.hpp>
+#include <benchmark/benchmark.h>
+#include <atomic>
+
+using namespace event_adapter;
+
+namespace {
+
+// Pipeline with range(0) typed predicate filters; the processed event
+// passes all of them.
+void BM_PipelineDepth(benchmark::State& state) {
+    EventPipeline pipeline;
+    for (int i = 0; i < state.range(0); ++i) {
+        pipeline.filter_by_predicate<DataUpdateEvent>(
+            [](const DataUpdateEvent& e) { return !e.source.empty(); });
+    }
+    auto event = make_event<DataUpdateEvent>("bench", "key", 1.0, 0.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pipeline.process(event));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PipelineDepth)->Arg(1)->Arg(4)->Arg(16)->Arg(32);
+
+// Pipeline where only one of range(0) filters matches the event's type;
+// measures the cost of routing an event past unrelated filters.
+void BM_PipelineNonMatchingFilters(benchmark::State& state) {
+    EventPipeline pipeline;
+    for (int i = 0; i < state.range(0) - 1; ++i) {
+        pipeline.filter_by_predicate<HeartbeatEvent>(
+            [](const HeartbeatEvent&) { return true; });
+    }
+    pipeline.filter_by_predicate<DataUpdateEvent>(
+        [](const DataUpdateEvent& e) { return !e.source.empty(); });
+    auto event = make_event<DataUpdateEvent>("bench", "key", 1.0, 0.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pipeline.process(event));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PipelineNonMatchingFilters)->Arg(4)->Arg(16)->Arg(32);
+
+class BenchAdapter : public DataSourceAdapter {
+public:
+    BenchAdapter() : DataSourceAdapter("bench") {}
+    void connect() override { set_state(State::Connected); }
+    void disconnect() override { set_state(State::Disconnected); }
+    bool is_connected() const override { return true; }
+
+    void emit_one(const EventPtr& event) { emit_event(event); }
+};
+
+void BM_EmitFanout(benchmark::State& state) {
+    BenchAdapter adapter;
+    std::atomic<std::uint64_t> handled{0};
+    for (int i = 0; i < state.range(0); ++i) {
+        adapter.subscribe([&handled](EventPtr) {
+            handled.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+    auto event = make_event<DataUpdateEvent>("bench", "key", 1.0, 0.0);
+    for (auto _ : state) {
+        adapter.emit_one(event);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EmitFanout)->Arg(1)->Arg(4)->Arg(16);
+
+} // namespace
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "../data_source_adapter.hpp"
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace event_adapter::adapters {
+
+// Decorator that conflates a DataUpdateEvent stream to "latest value per
+// (source, key)": updates from the wrapped adapter overwrite a cache entry
+// and mark it dirty, and the flush thread re-emits only dirty entries at
+// the configured interval. A 100kHz tick stream flushed every 10ms reaches
+// downstream handlers as at most 100 updates/s per key, with
+// previous_value set to the last value actually emitted. Non-DataUpdate
+// events (connection state, heartbeats) pass through unconflated.
+class ConflatingAdapter : public PollingDataSourceAdapter {
+public:
+    ConflatingAdapter(std::string name,
+                      std::shared_ptr<DataSourceAdapter> inner,
+                      std::chrono::milliseconds flush_interval)
+        : PollingDataSourceAdapter(std::move(name), flush_interval)
+        , inner_(std::move(inner))
+        , inner_handler_(std::make_shared<FunctionalEventHandler>([this](EventPtr event) {
+            on_inner_event(std::move(event));
+        })) {
+        inner_->subscribe(inner_handler_);
+    }
+
+    ~ConflatingAdapter() {
+        // The inner adapter may be co-owned and outlive this decorator;
+        // detach the this-capturing handler before tearing down.
+        inner_->unsubscribe(inner_handler_);
+        disconnect();
+    }
+
+    void connect() override {
+        inner_->connect();
+        PollingDataSourceAdapter::connect();
+    }
+
+    void disconnect() override {
+        if (!is_connected()) {
+            return;
+        }
+        inner_->disconnect();
+        PollingDataSourceAdapter::disconnect();
+        poll();  // final flush so the last values aren't lost
+    }
+
+    std::shared_ptr<DataSourceAdapter> inner() const { return inner_; }
+
+protected:
+    // Flush pass: emit every entry that changed since the last interval.
+    void poll() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [key, entry] : cache_) {
+            if (!entry.dirty) {
+                continue;
+            }
+            entry.dirty = false;
+            emit<DataUpdateEvent>(entry.latest.source, entry.latest.key,
+                                  entry.latest.value, entry.last_emitted);
+            entry.last_emitted = entry.latest.value;
+        }
+    }
+
+private:
+    struct Entry {
+        DataUpdateEvent latest;
+        std::any last_emitted;
+        bool dirty = false;
+    };
+
+    void on_inner_event(EventPtr event) {
+        if (event->type() != std::type_index(typeid(DataUpdateEvent))) {
+            emit_event(std::move(event));
+            return;
+        }
+        const auto& data = std::static_pointer_cast<TypedEvent<DataUpdateEvent>>(event)->data();
+        std::string key = data.source;
+        key.push_back('\0');
+        key.append(data.key);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& entry = cache_[key];
+        entry.latest = data;
+        entry.dirty = true;
+    }
+
+    std::shared_ptr<DataSourceAdapter> inner_;
+    std::shared_ptr<EventHandler> inner_handler_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, Entry> cache_;
+};
+
+} // namespace event_adapter::adapters
@@ -5,7 +5,7 @@
 #include <fstream>
 #include <chrono>
 #include <sstream>
-#include <set>
+#include <unordered_map>
 
 namespace event_adapter::adapters {
 
@@ -81,46 +81,62 @@ public:
         , path_(std::move(path)) {}
     
 protected:
+    // Incremental index instead of set-difference passes: each poll walks
+    // the directory once, stamping live entries with the current
+    // generation and updating mtimes in place; entries left on an old
+    // generation were removed. Filenames are interned once as map keys on
+    // first sighting, so an unchanged directory does no index mutation.
+    // mtime tracking also yields file_modified events, which the
+    // set-based diff could not detect.
     void poll() override {
         try {
             if (!fs::exists(path_) || !fs::is_directory(path_)) {
                 return;
             }
-            
-            std::set<std::string> current_files;
+
+            ++generation_;
             for (const auto& entry : fs::directory_iterator(path_)) {
-                current_files.insert(entry.path().filename().string());
-            }
-            
-            std::vector<std::string> added;
-            std::vector<std::string> removed;
-            
-            std::set_difference(current_files.begin(), current_files.end(),
-                              last_files_.begin(), last_files_.end(),
-                              std::back_inserter(added));
-            
-            std::set_difference(last_files_.begin(), last_files_.end(),
-                              current_files.begin(), current_files.end(),
-                              std::back_inserter(removed));
-            
-            for (const auto& file : added) {
-                emit<DataUpdateEvent>(name(), "file_added", file, std::string{});
+                std::string filename = entry.path().filename().string();
+                std::error_code ec;
+                auto mtime = fs::last_write_time(entry.path(), ec);
+
+                auto [it, inserted] = index_.try_emplace(std::move(filename),
+                                                         FileEntry{generation_, mtime});
+                if (inserted) {
+                    emit<DataUpdateEvent>(name(), "file_added", it->first, std::string{});
+                    continue;
+                }
+                if (!ec && it->second.mtime != mtime) {
+                    it->second.mtime = mtime;
+                    emit<DataUpdateEvent>(name(), "file_modified", it->first, std::string{});
+                }
+                it->second.generation = generation_;
             }
-            
-            for (const auto& file : removed) {
-                emit<DataUpdateEvent>(name(), "file_removed", file, std::string{});
+
+            // Removal sweep: anything not re-stamped this poll is gone.
+            for (auto it = index_.begin(); it != index_.end();) {
+                if (it->second.generation != generation_) {
+                    emit<DataUpdateEvent>(name(), "file_removed", it->first, std::string{});
+                    it = index_.erase(it);
+                } else {
+                    ++it;
+                }
             }
-            
-            last_files_ = std::move(current_files);
-            
+
         } catch (const fs::filesystem_error& e) {
             emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(), e.what());
         }
     }
     
 private:
+    struct FileEntry {
+        std::uint64_t generation;
+        fs::file_time_type mtime;
+    };
+
     std::string path_;
-    std::set<std::string> last_files_;
+    std::uint64_t generation_ = 0;
+    std::unordered_map<std::string, FileEntry> index_;
 };
 
 } // namespace event_adapter::adapters
\ No newline at end of file
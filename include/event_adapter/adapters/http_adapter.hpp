@@ -1,95 +1,383 @@
 #pragma once
 
 #include "../data_source_adapter.hpp"
+#include "../json_parser.hpp"
 #include <curl/curl.h>
+#include <cctype>
+#include <cstdlib>
 #include <thread>
 #include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 namespace event_adapter::adapters {
 
 using json = nlohmann::json;
 
+// Shared cache of warm CURL easy handles, keyed by host. libcurl keeps its
+// connection cache per easy handle, so returning a handle to the pool and
+// acquiring it again for the same host reuses the established (keep-alive)
+// connection instead of paying TCP+TLS setup on every request. Share one
+// pool across all HttpAdapter instances polling the same hosts.
+class HttpConnectionPool {
+public:
+    ~HttpConnectionPool() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [host, handles] : idle_handles_) {
+            for (CURL* handle : handles) {
+                curl_easy_cleanup(handle);
+            }
+        }
+    }
+
+    CURL* acquire(const std::string& host) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = idle_handles_.find(host);
+            if (it != idle_handles_.end() && !it->second.empty()) {
+                CURL* handle = it->second.back();
+                it->second.pop_back();
+                return handle;
+            }
+        }
+        return curl_easy_init();
+    }
+
+    void release(const std::string& host, CURL* handle) {
+        if (!handle) {
+            return;
+        }
+        // Reset options but keep the handle's connection cache warm.
+        curl_easy_reset(handle);
+        std::lock_guard<std::mutex> lock(mutex_);
+        idle_handles_[host].push_back(handle);
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::vector<CURL*>> idle_handles_;
+};
+
 class HttpAdapter : public PollingDataSourceAdapter {
 public:
-    HttpAdapter(std::string name, std::string url, std::chrono::milliseconds interval)
+    HttpAdapter(std::string name, std::string url, std::chrono::milliseconds interval,
+                std::shared_ptr<HttpConnectionPool> pool = nullptr)
         : PollingDataSourceAdapter(std::move(name), interval)
         , url_(std::move(url))
-        , curl_(nullptr) {
-        
+        , host_(host_from_url(url_))
+        , curl_(nullptr)
+        , pool_(std::move(pool)) {
+
         curl_global_init(CURL_GLOBAL_DEFAULT);
     }
-    
+
     ~HttpAdapter() {
         disconnect();
+        if (curl_) {
+            curl_easy_cleanup(curl_);
+            curl_ = nullptr;
+        }
         curl_global_cleanup();
     }
-    
+
+    // When enabled, responses are emitted as RawDataEvent carrying a
+    // SharedBuffer that takes over the response storage — no copy into the
+    // event and no retained last_response_. Consumers read buffer.view().
+    void enable_raw_buffer_events(bool enabled) {
+        raw_buffer_events_ = enabled;
+    }
+
+    // When enabled, body chunks are delivered incrementally through
+    // on_chunk() as libcurl receives them instead of being accumulated
+    // into one growing string: the first bytes reach a streaming parser
+    // while the rest of the response is still in flight, and nothing is
+    // buffered or reallocated. process_response() is not called.
+    void enable_streaming(bool enabled) {
+        streaming_ = enabled;
+    }
+
 protected:
     void poll() override {
         std::string response = fetch_data();
-        if (!response.empty()) {
+        if (response.empty()) {
+            return;
+        }
+        if (raw_buffer_events_) {
+            emit<RawDataEvent>(name(), "http_response", SharedBuffer::take(std::move(response)));
+        } else {
             process_response(response);
         }
     }
-    
+
     virtual void process_response(const std::string& response) {
         emit<DataUpdateEvent>(name(), "http_response", response, last_response_);
         last_response_ = response;
     }
-    
+
+    // Snapshot is the last cached response; nothing to offer before the
+    // first successful poll.
+    bool build_snapshot(std::vector<SnapshotEvent::Entry>& entries) override {
+        if (last_response_.empty()) {
+            return false;
+        }
+        entries.push_back({"http_response", last_response_});
+        return true;
+    }
+
+    // Streaming-mode hooks, called on the polling thread in arrival order.
+    // content_length_hint is 0 when the server sent no Content-Length
+    // (e.g. chunked transfer encoding).
+    virtual void on_response_begin(std::size_t content_length_hint) {
+        (void)content_length_hint;
+    }
+
+    virtual void on_chunk(std::string_view chunk) {
+        emit<RawDataEvent>(name(), "http_chunk", SharedBuffer::copy_of(chunk));
+    }
+
+    virtual void on_response_complete() {}
+
 private:
+    // Per-transfer callback state. In buffered mode `body` accumulates the
+    // response (pre-sized from Content-Length); in streaming mode it is
+    // null and chunks are forwarded straight to on_chunk().
+    struct TransferContext {
+        HttpAdapter* adapter = nullptr;
+        std::string* body = nullptr;
+        std::size_t content_length = 0;
+        bool body_started = false;
+    };
+
     static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
-        ((std::string*)userp)->append((char*)contents, size * nmemb);
-        return size * nmemb;
+        auto* ctx = static_cast<TransferContext*>(userp);
+        size_t total = size * nmemb;
+        if (!ctx->body_started) {
+            ctx->body_started = true;
+            if (ctx->body) {
+                // Reserve once up front so large responses don't pay
+                // repeated grow-and-copy while appending.
+                ctx->body->reserve(ctx->content_length);
+            } else {
+                ctx->adapter->on_response_begin(ctx->content_length);
+            }
+        }
+        if (ctx->body) {
+            ctx->body->append(static_cast<char*>(contents), total);
+        } else {
+            ctx->adapter->on_chunk(std::string_view(static_cast<char*>(contents), total));
+        }
+        return total;
     }
-    
+
+    static size_t header_callback(char* buffer, size_t size, size_t nitems, void* userp) {
+        auto* ctx = static_cast<TransferContext*>(userp);
+        size_t total = size * nitems;
+        std::string_view header(buffer, total);
+        constexpr std::string_view kContentLength = "content-length:";
+        if (header.size() > kContentLength.size()) {
+            bool matches = true;
+            for (size_t i = 0; i < kContentLength.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(header[i])) != kContentLength[i]) {
+                    matches = false;
+                    break;
+                }
+            }
+            if (matches) {
+                ctx->content_length = std::strtoull(header.data() + kContentLength.size(), nullptr, 10);
+            }
+        }
+        return total;
+    }
+
+    // "scheme://host[:port]/..." -> "host[:port]"; good enough as a pool key.
+    static std::string host_from_url(const std::string& url) {
+        auto start = url.find("://");
+        start = (start == std::string::npos) ? 0 : start + 3;
+        auto end = url.find('/', start);
+        return url.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    }
+
+    CURL* acquire_handle() {
+        if (pool_) {
+            return pool_->acquire(host_);
+        }
+        // No pool: keep one persistent handle per adapter so repeated polls
+        // reuse the same keep-alive connection.
+        if (!curl_) {
+            curl_ = curl_easy_init();
+        }
+        return curl_;
+    }
+
+    void release_handle(CURL* handle) {
+        if (pool_) {
+            pool_->release(host_, handle);
+        }
+        // Non-pooled handle stays in curl_ for the next poll.
+    }
+
     std::string fetch_data() {
         std::string response;
-        
-        CURL* curl = curl_easy_init();
+
+        CURL* curl = acquire_handle();
         if (curl) {
+            TransferContext ctx;
+            ctx.adapter = this;
+            ctx.body = streaming_ ? nullptr : &response;
+
             curl_easy_setopt(curl, CURLOPT_URL, url_.c_str());
             curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &ctx);
+            curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
+            curl_easy_setopt(curl, CURLOPT_HEADERDATA, &ctx);
             curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
-            
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+            curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
             CURLcode res = curl_easy_perform(curl);
-            
+
             if (res != CURLE_OK) {
-                emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(), 
+                emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(),
                                     std::string("HTTP request failed: ") + curl_easy_strerror(res));
+            } else if (streaming_ && ctx.body_started) {
+                on_response_complete();
             }
-            
-            curl_easy_cleanup(curl);
+
+            release_handle(curl);
         }
-        
+
         return response;
     }
-    
+
     std::string url_;
+    std::string host_;
     std::string last_response_;
     CURL* curl_;
+    std::shared_ptr<HttpConnectionPool> pool_;
+    bool raw_buffer_events_ = false;
+    bool streaming_ = false;
 };
 
 class JsonHttpAdapter : public HttpAdapter {
 public:
-    using HttpAdapter::HttpAdapter;
-    
+    // `parser` selects the parse backend (default: simdjson when built
+    // with it, nlohmann otherwise).
+    JsonHttpAdapter(std::string name, std::string url, std::chrono::milliseconds interval,
+                    std::shared_ptr<HttpConnectionPool> pool = nullptr,
+                    std::shared_ptr<JsonParserBackend> parser = nullptr)
+        : HttpAdapter(std::move(name), std::move(url), interval, std::move(pool))
+        , parser_(parser ? std::move(parser) : default_json_parser()) {}
+
+    // When enabled, responses are emitted as a LazyJsonDocument (key
+    // "json_lazy") that defers parsing until a handler first accesses
+    // dom(); handlers that only need a couple of fields, or none, skip
+    // materializing the whole DOM.
+    void enable_lazy_parsing(bool enabled) {
+        lazy_parsing_ = enabled;
+    }
+
 protected:
     void process_response(const std::string& response) override {
+        if (lazy_parsing_) {
+            emit<DataUpdateEvent>(name(), "json_lazy",
+                                  LazyJsonDocument(SharedBuffer::copy_of(response), parser_),
+                                  std::any{});
+            return;
+        }
         try {
-            json j = json::parse(response);
+            json j = parser_->parse(response);
             emit<DataUpdateEvent>(name(), "json_data", j, last_json_);
             last_json_ = j;
-        } catch (const json::parse_error& e) {
+            has_last_json_ = true;
+        } catch (const std::exception& e) {
             emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(), 
                                 std::string("JSON parse error: ") + e.what());
         }
     }
     
+    bool build_snapshot(std::vector<SnapshotEvent::Entry>& entries) override {
+        if (!has_last_json_) {
+            return false;
+        }
+        entries.push_back({"json_data", last_json_});
+        return true;
+    }
+
 private:
     json last_json_;
+    bool has_last_json_ = false;
+    std::shared_ptr<JsonParserBackend> parser_;
+    bool lazy_parsing_ = false;
+};
+
+// Streams newline-delimited JSON feeds: each complete line is parsed and
+// emitted as soon as its terminating newline arrives, while the rest of
+// the response is still in flight. Only the trailing partial line is
+// buffered between chunks.
+class NdjsonHttpAdapter : public HttpAdapter {
+public:
+    NdjsonHttpAdapter(std::string name, std::string url, std::chrono::milliseconds interval,
+                      std::shared_ptr<HttpConnectionPool> pool = nullptr,
+                      std::shared_ptr<JsonParserBackend> parser = nullptr)
+        : HttpAdapter(std::move(name), std::move(url), interval, std::move(pool))
+        , parser_(parser ? std::move(parser) : default_json_parser()) {
+        enable_streaming(true);
+    }
+
+protected:
+    void on_response_begin(std::size_t) override {
+        partial_line_.clear();
+    }
+
+    void on_chunk(std::string_view chunk) override {
+        while (!chunk.empty()) {
+            auto newline = chunk.find('\n');
+            if (newline == std::string_view::npos) {
+                partial_line_.append(chunk);
+                return;
+            }
+            if (partial_line_.empty()) {
+                process_line(chunk.substr(0, newline));
+            } else {
+                partial_line_.append(chunk.substr(0, newline));
+                process_line(partial_line_);
+                partial_line_.clear();
+            }
+            chunk.remove_prefix(newline + 1);
+        }
+    }
+
+    void on_response_complete() override {
+        if (!partial_line_.empty()) {
+            process_line(partial_line_);
+            partial_line_.clear();
+        }
+    }
+
+    virtual void on_json_line(const json& line) {
+        emit<DataUpdateEvent>(name(), "json_line", line, json{});
+    }
+
+private:
+    void process_line(std::string_view line) {
+        if (line.empty() || (line.size() == 1 && line[0] == '\r')) {
+            return;
+        }
+        if (line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        try {
+            on_json_line(parser_->parse(line));
+        } catch (const std::exception& e) {
+            emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(),
+                                std::string("NDJSON parse error: ") + e.what());
+        }
+    }
+
+    std::shared_ptr<JsonParserBackend> parser_;
+    std::string partial_line_;
 };
 
 } // namespace event_adapter::adapters
\ No newline at end of file
@@ -4,10 +4,12 @@
 #include <termios.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <array>
 #include <atomic>
 #include <thread>
 #include <iostream>
 #include <set>
+#include <boost/container/small_vector.hpp>
 
 namespace event_adapter::adapters {
 
@@ -41,9 +43,39 @@ struct SpecialKeyEvent {
         Backspace,
         Enter
     };
+    static constexpr std::size_t kKeyCount = Enter + 1;
     Key key;
 };
 
+// One event per read() call instead of one per character: pasting a block
+// produces a handful of these rather than thousands of allocations and
+// dispatcher wakeups. The small_vector keeps a whole 16-byte read inline,
+// so a batch costs one event allocation total.
+struct KeySequenceEvent {
+    struct Key {
+        enum class Kind { Character, Special };
+        Kind kind;
+        KeyPressEvent press{};             // valid when kind == Character
+        SpecialKeyEvent::Key special{};    // valid when kind == Special
+
+        static Key character(char ch, bool ctrl = false) {
+            Key k;
+            k.kind = Kind::Character;
+            k.press = KeyPressEvent{ch, ctrl, false, false};
+            return k;
+        }
+
+        static Key special_key(SpecialKeyEvent::Key key) {
+            Key k;
+            k.kind = Kind::Special;
+            k.special = key;
+            return k;
+        }
+    };
+
+    boost::container::small_vector<Key, 16> keys;
+};
+
 class KeyboardAdapter : public DataSourceAdapter {
 public:
     enum class Mode {
@@ -143,6 +175,13 @@ public:
     void set_echo(bool enabled) {
         echo_enabled_ = enabled;
     }
+
+    // When enabled, each read() emits one KeySequenceEvent carrying all
+    // decoded keys instead of one event per character. Subscribers handle
+    // KeySequenceEvent rather than KeyPressEvent/SpecialKeyEvent.
+    void set_batching(bool enabled) {
+        batching_ = enabled;
+    }
     
     void add_key_filter(char key) {
         filtered_keys_.insert(key);
@@ -175,7 +214,41 @@ private:
         }
     }
     
+    // The SpecialKeyEvent set is a fixed immutable enum, so the events are
+    // interned once and every press re-emits the same shared_ptr — no
+    // allocation per keystroke. Interned events share one id/timestamp;
+    // per-press identity comes from dispatch order.
+    static const EventPtr& interned_special(SpecialKeyEvent::Key key) {
+        static const auto events = []() {
+            std::array<EventPtr, SpecialKeyEvent::kKeyCount> all;
+            for (std::size_t i = 0; i < all.size(); ++i) {
+                all[i] = make_event<SpecialKeyEvent>(static_cast<SpecialKeyEvent::Key>(i));
+            }
+            return all;
+        }();
+        return events[static_cast<std::size_t>(key)];
+    }
+
+    void emit_special(SpecialKeyEvent::Key key) {
+        if (batch_) {
+            batch_->keys.push_back(KeySequenceEvent::Key::special_key(key));
+        } else {
+            emit_event(interned_special(key));
+        }
+    }
+
+    void emit_character(char ch, bool ctrl) {
+        if (batch_) {
+            batch_->keys.push_back(KeySequenceEvent::Key::character(ch, ctrl));
+        } else {
+            emit<KeyPressEvent>(ch, ctrl, false, false);
+        }
+    }
+
     void process_buffer(const char* buffer, ssize_t length) {
+        KeySequenceEvent batch;
+        batch_ = batching_ ? &batch : nullptr;
+
         for (ssize_t i = 0; i < length; ++i) {
             char ch = buffer[i];
             
@@ -190,18 +263,18 @@ private:
             
             // Handle special characters
             if (ch == 27) {
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Escape);
+                emit_special(SpecialKeyEvent::Escape);
             } else if (ch == '\t') {
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Tab);
+                emit_special(SpecialKeyEvent::Tab);
             } else if (ch == '\n' || ch == '\r') {
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Enter);
+                emit_special(SpecialKeyEvent::Enter);
                 if (echo_enabled_) std::cout << std::endl;
             } else if (ch == 127 || ch == 8) {
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Backspace);
+                emit_special(SpecialKeyEvent::Backspace);
                 if (echo_enabled_) std::cout << "\b \b" << std::flush;
             } else if (ch >= 1 && ch <= 26) {
                 // Ctrl+A through Ctrl+Z
-                emit<KeyPressEvent>(static_cast<char>('a' + ch - 1), true, false, false);
+                emit_character(static_cast<char>('a' + ch - 1), true);
             } else {
                 // Regular character
                 if (mode_ == Mode::Filtered && !filtered_keys_.empty()) {
@@ -210,43 +283,49 @@ private:
                     }
                 }
                 
-                emit<KeyPressEvent>(ch, false, false, false);
+                emit_character(ch, false);
                 if (echo_enabled_) std::cout << ch << std::flush;
             }
         }
+
+        if (batch_ && !batch.keys.empty()) {
+            batch_ = nullptr;
+            emit<KeySequenceEvent>(std::move(batch));
+        }
+        batch_ = nullptr;
     }
     
     void handle_escape_sequence(char seq) {
         switch (seq) {
             case 'A':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Arrow_Up);
+                emit_special(SpecialKeyEvent::Arrow_Up);
                 break;
             case 'B':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Arrow_Down);
+                emit_special(SpecialKeyEvent::Arrow_Down);
                 break;
             case 'C':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Arrow_Right);
+                emit_special(SpecialKeyEvent::Arrow_Right);
                 break;
             case 'D':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Arrow_Left);
+                emit_special(SpecialKeyEvent::Arrow_Left);
                 break;
             case 'H':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Home);
+                emit_special(SpecialKeyEvent::Home);
                 break;
             case 'F':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::End);
+                emit_special(SpecialKeyEvent::End);
                 break;
             case '2':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Insert);
+                emit_special(SpecialKeyEvent::Insert);
                 break;
             case '3':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Delete);
+                emit_special(SpecialKeyEvent::Delete);
                 break;
             case '5':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Page_Up);
+                emit_special(SpecialKeyEvent::Page_Up);
                 break;
             case '6':
-                emit<SpecialKeyEvent>(SpecialKeyEvent::Page_Down);
+                emit_special(SpecialKeyEvent::Page_Down);
                 break;
         }
     }
@@ -256,6 +335,8 @@ private:
     std::thread input_thread_;
     termios old_termios_;
     bool echo_enabled_;
+    bool batching_ = false;
+    KeySequenceEvent* batch_ = nullptr;
     std::set<char> filtered_keys_;
 };
 
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "../data_source_adapter.hpp"
+#include <curl/curl.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace event_adapter::adapters {
+
+// Drives many HTTP endpoints from a single event-loop thread using
+// curl_multi with non-blocking sockets, instead of one
+// PollingDataSourceAdapter thread (and one blocking curl_easy_perform)
+// per URL. Each endpoint keeps its own interval and its own persistent
+// easy handle, so connections stay warm across polls. Completed fetches
+// emit DataUpdateEvent(name(), endpoint_key, response, previous_response)
+// through the normal emit path.
+class MultiHttpAdapter : public DataSourceAdapter {
+public:
+    explicit MultiHttpAdapter(std::string name)
+        : DataSourceAdapter(std::move(name))
+        , multi_(nullptr)
+        , should_run_(false) {
+        curl_global_init(CURL_GLOBAL_DEFAULT);
+    }
+
+    ~MultiHttpAdapter() {
+        disconnect();
+        curl_global_cleanup();
+    }
+
+    // Endpoints must be added before connect().
+    void add_endpoint(std::string key, std::string url, std::chrono::milliseconds interval) {
+        auto endpoint = std::make_unique<Endpoint>();
+        endpoint->key = std::move(key);
+        endpoint->url = std::move(url);
+        endpoint->interval = interval;
+        endpoints_.push_back(std::move(endpoint));
+        EVENT_LOG_DEBUG("MultiHttpAdapter '{}' added endpoint '{}' ({}ms)",
+                        name(), endpoints_.back()->key, interval.count());
+    }
+
+    void connect() override {
+        set_state(State::Connecting);
+        multi_ = curl_multi_init();
+        if (!multi_) {
+            set_state(State::Error);
+            emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(), "curl_multi_init failed");
+            return;
+        }
+        should_run_ = true;
+        set_state(State::Connected);
+        loop_thread_ = std::thread([this]() {
+            event_loop();
+        });
+        emit<ConnectionEvent>(ConnectionEvent::Type::Connected, name(),
+                              std::to_string(endpoints_.size()) + " endpoints");
+    }
+
+    void disconnect() override {
+        if (!should_run_.exchange(false)) {
+            return;
+        }
+        set_state(State::Disconnecting);
+        curl_multi_wakeup(multi_);
+        if (loop_thread_.joinable()) {
+            loop_thread_.join();
+        }
+        for (auto& endpoint : endpoints_) {
+            if (endpoint->handle) {
+                if (endpoint->in_flight) {
+                    curl_multi_remove_handle(multi_, endpoint->handle);
+                }
+                curl_easy_cleanup(endpoint->handle);
+                endpoint->handle = nullptr;
+                endpoint->in_flight = false;
+            }
+        }
+        curl_multi_cleanup(multi_);
+        multi_ = nullptr;
+        set_state(State::Disconnected);
+        emit<ConnectionEvent>(ConnectionEvent::Type::Disconnected, name(), "");
+    }
+
+    bool is_connected() const override {
+        return should_run_.load();
+    }
+
+protected:
+    struct Endpoint {
+        std::string key;
+        std::string url;
+        std::chrono::milliseconds interval{};
+        std::string response;
+        std::string last_response;
+        CURL* handle = nullptr;
+        bool in_flight = false;
+        std::chrono::steady_clock::time_point next_due{};
+    };
+
+    virtual void process_response(Endpoint& endpoint) {
+        emit<DataUpdateEvent>(name(), endpoint.key, endpoint.response, endpoint.last_response);
+        endpoint.last_response = std::move(endpoint.response);
+        endpoint.response.clear();
+    }
+
+private:
+    static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
+        ((std::string*)userp)->append((char*)contents, size * nmemb);
+        return size * nmemb;
+    }
+
+    void event_loop() {
+        EVENT_LOG_DEBUG("MultiHttpAdapter '{}' event loop started", name());
+        while (should_run_) {
+            start_due_requests();
+
+            int still_running = 0;
+            curl_multi_perform(multi_, &still_running);
+            reap_completed();
+
+            int timeout_ms = static_cast<int>(std::min<std::int64_t>(ms_until_next_due(), 100));
+            int numfds = 0;
+            curl_multi_poll(multi_, nullptr, 0, timeout_ms, &numfds);
+        }
+        EVENT_LOG_DEBUG("MultiHttpAdapter '{}' event loop exiting", name());
+    }
+
+    void start_due_requests() {
+        auto now = std::chrono::steady_clock::now();
+        for (auto& endpoint : endpoints_) {
+            if (endpoint->in_flight || now < endpoint->next_due) {
+                continue;
+            }
+            if (!endpoint->handle) {
+                endpoint->handle = curl_easy_init();
+                if (!endpoint->handle) {
+                    continue;
+                }
+            }
+            endpoint->response.clear();
+            curl_easy_setopt(endpoint->handle, CURLOPT_URL, endpoint->url.c_str());
+            curl_easy_setopt(endpoint->handle, CURLOPT_WRITEFUNCTION, write_callback);
+            curl_easy_setopt(endpoint->handle, CURLOPT_WRITEDATA, &endpoint->response);
+            curl_easy_setopt(endpoint->handle, CURLOPT_TIMEOUT, 10L);
+            curl_easy_setopt(endpoint->handle, CURLOPT_TCP_KEEPALIVE, 1L);
+            curl_easy_setopt(endpoint->handle, CURLOPT_NOSIGNAL, 1L);
+            curl_easy_setopt(endpoint->handle, CURLOPT_PRIVATE, endpoint.get());
+            curl_multi_add_handle(multi_, endpoint->handle);
+            endpoint->in_flight = true;
+        }
+    }
+
+    void reap_completed() {
+        int msgs_left = 0;
+        while (CURLMsg* msg = curl_multi_info_read(multi_, &msgs_left)) {
+            if (msg->msg != CURLMSG_DONE) {
+                continue;
+            }
+            Endpoint* endpoint = nullptr;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &endpoint);
+            CURLcode result = msg->data.result;
+            curl_multi_remove_handle(multi_, msg->easy_handle);
+            if (!endpoint) {
+                continue;
+            }
+            endpoint->in_flight = false;
+            // Schedule relative to completion so slow endpoints don't pile up.
+            endpoint->next_due = std::chrono::steady_clock::now() + endpoint->interval;
+            if (result != CURLE_OK) {
+                emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(),
+                                      endpoint->key + ": " + curl_easy_strerror(result));
+                continue;
+            }
+            if (!endpoint->response.empty()) {
+                process_response(*endpoint);
+            }
+        }
+    }
+
+    std::int64_t ms_until_next_due() const {
+        auto now = std::chrono::steady_clock::now();
+        std::int64_t best = 100;
+        for (const auto& endpoint : endpoints_) {
+            if (endpoint->in_flight) {
+                continue;
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(endpoint->next_due - now).count();
+            if (ms < best) {
+                best = ms < 0 ? 0 : ms;
+            }
+        }
+        return best;
+    }
+
+    CURLM* multi_;
+    std::atomic<bool> should_run_;
+    std::thread loop_thread_;
+    std::vector<std::unique_ptr<Endpoint>> endpoints_;
+};
+
+} // namespace event_adapter::adapters
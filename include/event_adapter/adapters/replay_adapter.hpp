@@ -0,0 +1,171 @@
+#pragma once
+
+#include "../data_source_adapter.hpp"
+#include "../event_journal.hpp"
+#include "../logging.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace event_adapter::adapters {
+
+// Re-emits a recorded event journal through the normal emit_event path,
+// so the replayed stream is indistinguishable to subscribers from the
+// live one. The journal file is memory-mapped read-only: records are
+// decoded straight out of the page cache with no read() copies and no
+// upfront load of the whole file.
+//
+// `speed` scales the original inter-event gaps: 1.0 replays in real
+// time, 2.0 at double speed, 0.0 replays as fast as events decode.
+class ReplayAdapter : public DataSourceAdapter {
+public:
+    ReplayAdapter(std::string name, std::string path, double speed = 1.0,
+                  std::shared_ptr<JournalCodecRegistry> codecs = nullptr)
+        : DataSourceAdapter(std::move(name))
+        , path_(std::move(path))
+        , speed_(speed)
+        , codecs_(codecs ? std::move(codecs) : default_journal_codecs()) {}
+
+    ~ReplayAdapter() {
+        disconnect();
+    }
+
+    void connect() override {
+        EVENT_LOG_INFO("ReplayAdapter '{}' opening journal '{}'", name(), path_);
+        set_state(State::Connecting);
+
+        int fd = ::open(path_.c_str(), O_RDONLY);
+        if (fd < 0) {
+            fail("cannot open journal file");
+            return;
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(std::uint32_t))) {
+            ::close(fd);
+            fail("journal file missing or too short");
+            return;
+        }
+        map_size_ = static_cast<std::size_t>(st.st_size);
+        map_ = ::mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (map_ == MAP_FAILED) {
+            map_ = nullptr;
+            fail("mmap failed");
+            return;
+        }
+
+        std::uint32_t magic;
+        std::memcpy(&magic, map_, sizeof(magic));
+        if (magic != EventJournalWriter::kMagic) {
+            unmap();
+            fail("not an event journal (bad magic)");
+            return;
+        }
+
+        running_ = true;
+        set_state(State::Connected);
+        emit<ConnectionEvent>(ConnectionEvent::Type::Connected, name(), path_);
+        replay_thread_ = std::thread([this]() { replay(); });
+    }
+
+    void disconnect() override {
+        running_ = false;
+        if (replay_thread_.joinable()) {
+            replay_thread_.join();
+        }
+        unmap();
+        set_state(State::Disconnected);
+    }
+
+    bool is_connected() const override {
+        return running_.load();
+    }
+
+    std::uint64_t events_replayed() const {
+        return events_replayed_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void fail(const char* what) {
+        EVENT_LOG_ERROR("ReplayAdapter '{}': {} ({})", name(), what, path_);
+        set_state(State::Error);
+        emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(), what);
+    }
+
+    void unmap() {
+        if (map_) {
+            ::munmap(map_, map_size_);
+            map_ = nullptr;
+            map_size_ = 0;
+        }
+    }
+
+    void replay() {
+        EVENT_LOG_DEBUG("ReplayAdapter '{}' replay thread started", name());
+        const char* data = static_cast<const char*>(map_);
+        std::size_t offset = sizeof(std::uint32_t);
+
+        bool have_origin = false;
+        std::uint64_t origin_ns = 0;
+        auto wall_origin = std::chrono::steady_clock::now();
+
+        while (running_.load() && offset + kRecordHeader <= map_size_) {
+            std::uint32_t payload_len, tag;
+            std::uint64_t timestamp_ns;
+            std::memcpy(&payload_len, data + offset, sizeof(payload_len));
+            std::memcpy(&tag, data + offset + 4, sizeof(tag));
+            std::memcpy(&timestamp_ns, data + offset + 8, sizeof(timestamp_ns));
+            offset += kRecordHeader;
+            if (offset + payload_len > map_size_) {
+                EVENT_LOG_WARN("ReplayAdapter '{}' journal ends mid-record, stopping", name());
+                break;
+            }
+
+            if (speed_ > 0.0) {
+                if (!have_origin) {
+                    have_origin = true;
+                    origin_ns = timestamp_ns;
+                    wall_origin = std::chrono::steady_clock::now();
+                } else {
+                    auto elapsed_ns = static_cast<double>(timestamp_ns - origin_ns) / speed_;
+                    std::this_thread::sleep_until(
+                        wall_origin + std::chrono::nanoseconds(static_cast<std::int64_t>(elapsed_ns)));
+                }
+            }
+
+            journal_wire::Reader reader(std::string_view(data + offset, payload_len));
+            offset += payload_len;
+            try {
+                if (EventPtr event = codecs_->decode(tag, reader)) {
+                    emit_event(std::move(event));
+                    events_replayed_.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    EVENT_LOG_WARN("ReplayAdapter '{}' skipping unknown record tag {}", name(), tag);
+                }
+            } catch (const std::exception& e) {
+                EVENT_LOG_ERROR("ReplayAdapter '{}' decode error: {}", name(), e.what());
+                break;
+            }
+        }
+
+        EVENT_LOG_INFO("ReplayAdapter '{}' replay finished, {} events",
+                       name(), events_replayed_.load(std::memory_order_relaxed));
+        running_ = false;
+        emit<ConnectionEvent>(ConnectionEvent::Type::Disconnected, name(), path_);
+    }
+
+    static constexpr std::size_t kRecordHeader = 16;  // len + tag + timestamp
+
+    std::string path_;
+    double speed_;
+    std::shared_ptr<JournalCodecRegistry> codecs_;
+    void* map_ = nullptr;
+    std::size_t map_size_ = 0;
+    std::atomic<bool> running_{false};
+    std::atomic<std::uint64_t> events_replayed_{0};
+    std::thread replay_thread_;
+};
+
+} // namespace event_adapter::adapters
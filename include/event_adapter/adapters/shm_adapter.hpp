@@ -0,0 +1,355 @@
+#pragma once
+
+// Shared-memory event transport (Linux): a single-writer broadcast ring
+// over shm_open+mmap with per-slot sequence numbers, so cross-process
+// fan-out costs two atomic stores and a memcpy per event instead of a
+// localhost socket round trip. Events are serialized with the journal
+// codec registry, so anything the journal can record can cross processes.
+#ifdef __linux__
+
+#include "../data_source_adapter.hpp"
+#include "../event_journal.hpp"
+#include "../logging.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace event_adapter::adapters {
+
+namespace shm_detail {
+
+constexpr std::uint32_t kShmMagic = 0x4D534145;  // "EASM"
+
+// Lives at offset 0 of the mapping. next_seq is only written by the
+// producer; readers use it to resynchronize after an overrun.
+struct RingHeader {
+    std::uint32_t magic;
+    std::uint32_t slot_size;
+    std::uint64_t slot_count;  // power of two
+    std::atomic<std::uint64_t> next_seq;
+};
+
+// Seqlock per slot: sequence is 2s+1 while slot s%N is being written and
+// 2s+2 once published. A reader that sees a larger value than it expects
+// has been lapped and resynchronizes.
+struct SlotHeader {
+    std::atomic<std::uint64_t> sequence;
+    std::uint32_t payload_size;
+    std::uint32_t tag;
+};
+
+inline std::size_t round_up_pow2(std::size_t n) {
+    std::size_t p = 1;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+} // namespace shm_detail
+
+// Producer half: serializes each event into the next ring slot. Create
+// one per shared stream and subscribe it to adapters or use it as a
+// dispatcher tap, like EventJournalWriter:
+//   ShmEventWriter writer("/md_feed");
+//   adapter.subscribe(writer.handler());
+// The writer creates and owns the shm object and unlinks it on
+// destruction; existing reader mappings stay valid.
+class ShmEventWriter {
+public:
+    explicit ShmEventWriter(const std::string& shm_name,
+                            std::size_t slot_count = 4096,
+                            std::size_t slot_size = 1024,
+                            std::shared_ptr<JournalCodecRegistry> codecs = nullptr)
+        : shm_name_(shm_name)
+        , codecs_(codecs ? std::move(codecs) : default_journal_codecs()) {
+        slot_count = shm_detail::round_up_pow2(slot_count);
+        map_size_ = sizeof(shm_detail::RingHeader) + slot_count * slot_size;
+
+        int fd = ::shm_open(shm_name_.c_str(), O_CREAT | O_RDWR | O_EXCL, 0600);
+        if (fd < 0) {
+            throw std::runtime_error("ShmEventWriter: shm_open failed for " + shm_name_);
+        }
+        if (::ftruncate(fd, static_cast<off_t>(map_size_)) != 0) {
+            ::close(fd);
+            ::shm_unlink(shm_name_.c_str());
+            throw std::runtime_error("ShmEventWriter: ftruncate failed for " + shm_name_);
+        }
+        map_ = ::mmap(nullptr, map_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (map_ == MAP_FAILED) {
+            ::shm_unlink(shm_name_.c_str());
+            throw std::runtime_error("ShmEventWriter: mmap failed for " + shm_name_);
+        }
+
+        header_ = static_cast<shm_detail::RingHeader*>(map_);
+        header_->slot_size = static_cast<std::uint32_t>(slot_size);
+        header_->slot_count = slot_count;
+        header_->next_seq.store(0, std::memory_order_relaxed);
+        // Publish the magic last so readers never see a half-set-up ring.
+        reinterpret_cast<std::atomic<std::uint32_t>*>(&header_->magic)
+            ->store(shm_detail::kShmMagic, std::memory_order_release);
+        EVENT_LOG_INFO("ShmEventWriter '{}' created ({} slots x {} bytes)",
+                       shm_name_, slot_count, slot_size);
+    }
+
+    ~ShmEventWriter() {
+        if (map_) {
+            ::munmap(map_, map_size_);
+        }
+        ::shm_unlink(shm_name_.c_str());
+    }
+
+    ShmEventWriter(const ShmEventWriter&) = delete;
+    ShmEventWriter& operator=(const ShmEventWriter&) = delete;
+
+    void record(const EventPtr& event) {
+        scratch_.clear();
+        std::uint32_t tag = 0;
+        if (!codecs_->encode(event, tag, scratch_)) {
+            skipped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::size_t max_payload = header_->slot_size - sizeof(shm_detail::SlotHeader);
+        if (scratch_.size() > max_payload) {
+            EVENT_LOG_WARN("ShmEventWriter '{}' event of {} bytes exceeds slot payload {}",
+                           shm_name_, scratch_.size(), max_payload);
+            skipped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::uint64_t seq = header_->next_seq.load(std::memory_order_relaxed);
+        auto* slot = slot_at(seq);
+        // Seqlock write-begin: a release store only orders what precedes
+        // it, so the payload writes below could be hoisted above the odd
+        // store on weakly-ordered hardware and a reader would copy a torn
+        // slot against a still-even sequence. Relaxed store plus release
+        // fence (write_seqcount_begin + smp_wmb) keeps them after it.
+        slot->sequence.store(2 * seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->payload_size = static_cast<std::uint32_t>(scratch_.size());
+        slot->tag = tag;
+        std::memcpy(reinterpret_cast<char*>(slot) + sizeof(shm_detail::SlotHeader),
+                    scratch_.data(), scratch_.size());
+        slot->sequence.store(2 * seq + 2, std::memory_order_release);
+        header_->next_seq.store(seq + 1, std::memory_order_release);
+        written_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::function<void(EventPtr)> handler() {
+        return [this](EventPtr event) { record(event); };
+    }
+
+    std::uint64_t written() const { return written_.load(std::memory_order_relaxed); }
+    std::uint64_t skipped() const { return skipped_.load(std::memory_order_relaxed); }
+
+private:
+    shm_detail::SlotHeader* slot_at(std::uint64_t seq) {
+        std::size_t index = seq & (header_->slot_count - 1);
+        char* base = static_cast<char*>(map_) + sizeof(shm_detail::RingHeader);
+        return reinterpret_cast<shm_detail::SlotHeader*>(base + index * header_->slot_size);
+    }
+
+    std::string shm_name_;
+    std::shared_ptr<JournalCodecRegistry> codecs_;
+    void* map_ = nullptr;
+    std::size_t map_size_ = 0;
+    shm_detail::RingHeader* header_ = nullptr;
+    std::string scratch_;
+    std::atomic<std::uint64_t> written_{0};
+    std::atomic<std::uint64_t> skipped_{0};
+};
+
+// Consumer half: maps the ring read-only and re-emits decoded events
+// through the normal emit_event path, so subscribing a dispatcher works
+// exactly like any other adapter. Reads are lock-free: a slot is copied
+// out and its sequence re-checked (seqlock), so a concurrent writer lap
+// is detected rather than yielding torn events. A lapped reader skips
+// ahead to the oldest valid slot and counts the gap in events_lost().
+class ShmReaderAdapter : public DataSourceAdapter {
+public:
+    ShmReaderAdapter(std::string name, std::string shm_name,
+                     std::shared_ptr<JournalCodecRegistry> codecs = nullptr)
+        : DataSourceAdapter(std::move(name))
+        , shm_name_(std::move(shm_name))
+        , codecs_(codecs ? std::move(codecs) : default_journal_codecs()) {}
+
+    ~ShmReaderAdapter() {
+        disconnect();
+    }
+
+    void connect() override {
+        EVENT_LOG_INFO("ShmReaderAdapter '{}' opening '{}'", name(), shm_name_);
+        set_state(State::Connecting);
+
+        int fd = ::shm_open(shm_name_.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            fail("shm_open failed");
+            return;
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(shm_detail::RingHeader))) {
+            ::close(fd);
+            fail("ring missing or too small");
+            return;
+        }
+        map_size_ = static_cast<std::size_t>(st.st_size);
+        map_ = ::mmap(nullptr, map_size_, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (map_ == MAP_FAILED) {
+            map_ = nullptr;
+            fail("mmap failed");
+            return;
+        }
+        header_ = static_cast<const shm_detail::RingHeader*>(map_);
+        if (reinterpret_cast<const std::atomic<std::uint32_t>*>(&header_->magic)
+                ->load(std::memory_order_acquire) != shm_detail::kShmMagic) {
+            unmap();
+            fail("bad ring magic");
+            return;
+        }
+
+        // Start at the live edge; replaying history is the journal's job.
+        next_seq_ = header_->next_seq.load(std::memory_order_acquire);
+        running_ = true;
+        set_state(State::Connected);
+        emit<ConnectionEvent>(ConnectionEvent::Type::Connected, name(), shm_name_);
+        reader_thread_ = std::thread([this]() { read_loop(); });
+    }
+
+    void disconnect() override {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        if (reader_thread_.joinable()) {
+            reader_thread_.join();
+        }
+        unmap();
+        set_state(State::Disconnected);
+    }
+
+    bool is_connected() const override {
+        return running_.load();
+    }
+
+    std::uint64_t events_received() const { return received_.load(std::memory_order_relaxed); }
+    std::uint64_t events_lost() const { return lost_.load(std::memory_order_relaxed); }
+
+private:
+    void fail(const char* what) {
+        EVENT_LOG_ERROR("ShmReaderAdapter '{}': {} ({})", name(), what, shm_name_);
+        set_state(State::Error);
+        emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(), what);
+    }
+
+    void unmap() {
+        if (map_) {
+            ::munmap(const_cast<void*>(map_), map_size_);
+            map_ = nullptr;
+            header_ = nullptr;
+        }
+    }
+
+    const shm_detail::SlotHeader* slot_at(std::uint64_t seq) const {
+        std::size_t index = seq & (header_->slot_count - 1);
+        const char* base = static_cast<const char*>(map_) + sizeof(shm_detail::RingHeader);
+        return reinterpret_cast<const shm_detail::SlotHeader*>(base + index * header_->slot_size);
+    }
+
+    enum class ReadResult { Ok, Empty, Lapped };
+
+    ReadResult try_read(std::string& payload, std::uint32_t& tag) {
+        const auto* slot = slot_at(next_seq_);
+        std::uint64_t expected = 2 * next_seq_ + 2;
+        std::uint64_t seq0 = slot->sequence.load(std::memory_order_acquire);
+        if (seq0 < expected) {
+            return ReadResult::Empty;
+        }
+        if (seq0 > expected) {
+            return ReadResult::Lapped;
+        }
+        payload.assign(reinterpret_cast<const char*>(slot) + sizeof(shm_detail::SlotHeader),
+                       slot->payload_size);
+        tag = slot->tag;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) != expected) {
+            return ReadResult::Lapped;  // writer caught us mid-copy
+        }
+        ++next_seq_;
+        return ReadResult::Ok;
+    }
+
+    void resync() {
+        std::uint64_t writer_next = header_->next_seq.load(std::memory_order_acquire);
+        // Leave one slot of headroom: the slot right at next-N may be
+        // overwritten while we read it.
+        std::uint64_t oldest_safe =
+            writer_next > header_->slot_count - 1 ? writer_next - (header_->slot_count - 1) : 0;
+        if (oldest_safe > next_seq_) {
+            lost_.fetch_add(oldest_safe - next_seq_, std::memory_order_relaxed);
+            EVENT_LOG_WARN("ShmReaderAdapter '{}' lapped, skipping {} events",
+                           name(), oldest_safe - next_seq_);
+            next_seq_ = oldest_safe;
+        }
+    }
+
+    void read_loop() {
+        EVENT_LOG_DEBUG("ShmReaderAdapter '{}' reader thread started", name());
+        constexpr int kIdleSpins = 4096;
+        std::string payload;
+        std::uint32_t tag = 0;
+        int idle = 0;
+        while (running_.load(std::memory_order_relaxed)) {
+            switch (try_read(payload, tag)) {
+            case ReadResult::Ok:
+                idle = 0;
+                decode_and_emit(payload, tag);
+                break;
+            case ReadResult::Lapped:
+                resync();
+                break;
+            case ReadResult::Empty:
+                // Spin at the live edge for µs-level latency, then back
+                // off so an idle feed doesn't burn a core.
+                if (++idle < kIdleSpins) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+                break;
+            }
+        }
+        EVENT_LOG_DEBUG("ShmReaderAdapter '{}' reader thread stopped", name());
+    }
+
+    void decode_and_emit(const std::string& payload, std::uint32_t tag) {
+        journal_wire::Reader reader(payload);
+        try {
+            if (EventPtr event = codecs_->decode(tag, reader)) {
+                emit_event(std::move(event));
+                received_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                EVENT_LOG_WARN("ShmReaderAdapter '{}' unknown event tag {}", name(), tag);
+            }
+        } catch (const std::exception& e) {
+            EVENT_LOG_ERROR("ShmReaderAdapter '{}' decode error: {}", name(), e.what());
+        }
+    }
+
+    std::string shm_name_;
+    std::shared_ptr<JournalCodecRegistry> codecs_;
+    const void* map_ = nullptr;
+    std::size_t map_size_ = 0;
+    const shm_detail::RingHeader* header_ = nullptr;
+    std::uint64_t next_seq_ = 0;
+    std::atomic<bool> running_{false};
+    std::atomic<std::uint64_t> received_{0};
+    std::atomic<std::uint64_t> lost_{0};
+    std::thread reader_thread_;
+};
+
+} // namespace event_adapter::adapters
+
+#endif // __linux__
@@ -1,23 +1,63 @@
 #pragma once
 
 #include "../data_source_adapter.hpp"
+#include "../json_parser.hpp"
 #include "../logging.hpp"
 #include <websocketpp/client.hpp>
 #include <websocketpp/config/asio_no_tls_client.hpp>
+#include <cstdint>
+#include <functional>
 #include <nlohmann/json.hpp>
 
 namespace event_adapter::adapters {
 
 using json = nlohmann::json;
 
+// Pluggable decoder for binary (opcode 0x2) WebSocket frames, for
+// fixed-layout protocols (SBE, protobuf, exchange-native) that are far
+// cheaper to decode than text JSON. The payload aliases websocketpp's
+// message buffer — no copy is made; it is only guaranteed alive for the
+// duration of decode(), so retain `owner` (the message object) if bytes
+// must outlive the call, e.g. via SharedBuffer::view_of. Decoded events
+// are handed to `emit`, which fans out through the adapter's normal
+// subscriber path; one frame may produce any number of events.
+class BinaryFrameDecoder {
+public:
+    virtual ~BinaryFrameDecoder() = default;
+
+    virtual void decode(const std::uint8_t* data, std::size_t size,
+                        const std::shared_ptr<const void>& owner,
+                        const std::function<void(EventPtr)>& emit) = 0;
+};
+
+class FunctionalBinaryFrameDecoder : public BinaryFrameDecoder {
+public:
+    using Callback = std::function<void(const std::uint8_t*, std::size_t,
+                                        const std::shared_ptr<const void>&,
+                                        const std::function<void(EventPtr)>&)>;
+
+    explicit FunctionalBinaryFrameDecoder(Callback callback) : callback_(std::move(callback)) {}
+
+    void decode(const std::uint8_t* data, std::size_t size,
+                const std::shared_ptr<const void>& owner,
+                const std::function<void(EventPtr)>& emit) override {
+        callback_(data, size, owner, emit);
+    }
+
+private:
+    Callback callback_;
+};
+
 class WebSocketAdapter : public DataSourceAdapter {
 public:
     using client = websocketpp::client<websocketpp::config::asio_client>;
     using message_ptr = websocketpp::config::asio_client::message_type::ptr;
     
-    WebSocketAdapter(std::string name, std::string uri) 
+    WebSocketAdapter(std::string name, std::string uri,
+                     std::shared_ptr<JsonParserBackend> parser = nullptr)
         : DataSourceAdapter(std::move(name))
-        , uri_(std::move(uri)) {
+        , uri_(std::move(uri))
+        , parser_(parser ? std::move(parser) : default_json_parser()) {
         
         EVENT_LOG_INFO("WebSocketAdapter '{}' created with URI: {}", this->name(), uri_);
         
@@ -116,18 +156,63 @@ public:
         EVENT_LOG_TRACE("WebSocketAdapter '{}' sending JSON message", name());
         send_message(data.dump());
     }
+
+    // When enabled, incoming frames are emitted as RawDataEvent whose
+    // SharedBuffer aliases the websocketpp message payload (the message
+    // object is kept alive as the buffer's owner), bypassing the
+    // string-copy and JSON-parse path entirely.
+    void enable_raw_buffer_events(bool enabled) {
+        raw_buffer_events_ = enabled;
+    }
+
+    // When enabled, incoming frames are wrapped in a LazyJsonDocument
+    // (key "json_lazy") aliasing the message payload: nothing is parsed
+    // until a handler first accesses dom().
+    void enable_lazy_parsing(bool enabled) {
+        lazy_parsing_ = enabled;
+    }
+
+    // Routes binary frames through `decoder` instead of the text/JSON
+    // path. Without a decoder, binary frames are emitted as RawDataEvent
+    // (key "binary") aliasing the message payload.
+    void set_binary_decoder(std::shared_ptr<BinaryFrameDecoder> decoder) {
+        binary_decoder_ = std::move(decoder);
+    }
+
+    void set_binary_decoder(FunctionalBinaryFrameDecoder::Callback callback) {
+        set_binary_decoder(std::make_shared<FunctionalBinaryFrameDecoder>(std::move(callback)));
+    }
     
 protected:
     virtual void on_json_message(const json& message) {
         emit<DataUpdateEvent>("websocket", "message", message, json{});
     }
     
+    virtual void on_binary_message(const message_ptr& msg) {
+        const std::string& payload = msg->get_payload();
+        EVENT_LOG_TRACE("WebSocketAdapter '{}' received binary frame: {} bytes", name(), payload.size());
+        if (binary_decoder_) {
+            try {
+                binary_decoder_->decode(reinterpret_cast<const std::uint8_t*>(payload.data()),
+                                        payload.size(), msg,
+                                        [this](EventPtr event) { emit_event(std::move(event)); });
+            } catch (const std::exception& e) {
+                EVENT_LOG_ERROR("WebSocketAdapter '{}' binary decode error: {}", name(), e.what());
+                emit<ConnectionEvent>(ConnectionEvent::Type::Error, name(),
+                                    std::string("binary decode error: ") + e.what());
+            }
+            return;
+        }
+        emit<RawDataEvent>(name(), "binary",
+                           SharedBuffer::view_of(msg, payload.data(), payload.size()));
+    }
+
     virtual void on_text_message(const std::string& message) {
         EVENT_LOG_TRACE("WebSocketAdapter '{}' received message: {} bytes", name(), message.size());
         try {
-            json j = json::parse(message);
+            json j = parser_->parse(message);
             on_json_message(j);
-        } catch (const json::parse_error& e) {
+        } catch (const std::exception& e) {
             EVENT_LOG_WARN("WebSocketAdapter '{}' JSON parse error: {}", name(), e.what());
             emit<DataUpdateEvent>("websocket", "raw_message", message, std::string{});
         }
@@ -147,6 +232,25 @@ private:
     }
     
     void on_message(websocketpp::connection_hdl hdl, message_ptr msg) {
+        if (msg->get_opcode() == websocketpp::frame::opcode::binary) {
+            on_binary_message(msg);
+            return;
+        }
+        if (raw_buffer_events_) {
+            const std::string& payload = msg->get_payload();
+            emit<RawDataEvent>(name(), "message",
+                               SharedBuffer::view_of(msg, payload.data(), payload.size()));
+            return;
+        }
+        if (lazy_parsing_) {
+            const std::string& payload = msg->get_payload();
+            emit<DataUpdateEvent>(name(), "json_lazy",
+                                  LazyJsonDocument(
+                                      SharedBuffer::view_of(msg, payload.data(), payload.size()),
+                                      parser_),
+                                  std::any{});
+            return;
+        }
         on_text_message(msg->get_payload());
     }
     
@@ -160,6 +264,10 @@ private:
     client client_;
     client::connection_ptr connection_;
     std::thread client_thread_;
+    std::shared_ptr<JsonParserBackend> parser_;
+    std::shared_ptr<BinaryFrameDecoder> binary_decoder_;
+    bool raw_buffer_events_ = false;
+    bool lazy_parsing_ = false;
 };
 
 } // namespace event_adapter::adapters
\ No newline at end of file
@@ -0,0 +1,343 @@
+#pragma once
+
+// Coroutine execution layer: many adapters multiplexed onto a small,
+// shared worker pool instead of one OS thread per adapter. The library
+// itself builds as C++17, so everything here is gated on compiler
+// coroutine support and only available to consumers building as C++20.
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include "data_source_adapter.hpp"
+#include "logging.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace event_adapter {
+
+// Fixed pool of worker threads that resume coroutine handles. Ready
+// handles run FIFO; timed handles sit in a deadline min-heap and move to
+// the ready queue when due. 500 sleeping adapters cost 500 small
+// coroutine frames here, not 500 stacks.
+class AsyncExecutor {
+public:
+    explicit AsyncExecutor(std::size_t thread_count = 4) {
+        running_ = true;
+        workers_.reserve(thread_count);
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            workers_.emplace_back([this]() { run(); });
+        }
+        EVENT_LOG_INFO("AsyncExecutor started with {} threads", thread_count);
+    }
+
+    ~AsyncExecutor() {
+        stop();
+    }
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    // Resumes every pending coroutine (sleepers wake early), then joins
+    // the workers once the queues drain.
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!running_) {
+                return;
+            }
+            running_ = false;
+            while (!timers_.empty()) {
+                ready_.push_back(timers_.top().handle);
+                timers_.pop();
+            }
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        EVENT_LOG_INFO("AsyncExecutor stopped");
+    }
+
+    bool is_running() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return running_;
+    }
+
+    // co_await executor.schedule() hops the coroutine onto a worker.
+    auto schedule() {
+        struct Awaiter {
+            AsyncExecutor* executor;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { executor->post(handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this};
+    }
+
+    // co_await executor.sleep_for(interval) parks the coroutine without
+    // occupying a worker. May resume early on wake_sleepers()/stop();
+    // callers re-check their own condition after waking.
+    auto sleep_for(std::chrono::milliseconds duration) {
+        struct Awaiter {
+            AsyncExecutor* executor;
+            std::chrono::steady_clock::time_point deadline;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) {
+                executor->post_timed(handle, deadline);
+            }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this, std::chrono::steady_clock::now() + duration};
+    }
+
+    // Resumes all sleeping coroutines now, e.g. so a disconnecting
+    // adapter's loop can observe its stop flag without waiting out a
+    // long polling interval.
+    void wake_sleepers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (!timers_.empty()) {
+                ready_.push_back(timers_.top().handle);
+                timers_.pop();
+            }
+        }
+        cv_.notify_all();
+    }
+
+private:
+    struct TimedHandle {
+        std::chrono::steady_clock::time_point deadline;
+        std::coroutine_handle<> handle;
+        bool operator>(const TimedHandle& other) const { return deadline > other.deadline; }
+    };
+
+    void post(std::coroutine_handle<> handle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ready_.push_back(handle);
+        }
+        cv_.notify_one();
+    }
+
+    void post_timed(std::coroutine_handle<> handle, std::chrono::steady_clock::time_point deadline) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            timers_.push(TimedHandle{deadline, handle});
+        }
+        cv_.notify_one();
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            auto now = std::chrono::steady_clock::now();
+            while (!timers_.empty() && timers_.top().deadline <= now) {
+                ready_.push_back(timers_.top().handle);
+                timers_.pop();
+            }
+            if (!ready_.empty()) {
+                auto handle = ready_.front();
+                ready_.pop_front();
+                lock.unlock();
+                handle.resume();
+                lock.lock();
+                continue;
+            }
+            if (!running_) {
+                return;
+            }
+            if (timers_.empty()) {
+                cv_.wait(lock);
+            } else {
+                cv_.wait_until(lock, timers_.top().deadline);
+            }
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::coroutine_handle<>> ready_;
+    std::priority_queue<TimedHandle, std::vector<TimedHandle>, std::greater<TimedHandle>> timers_;
+    bool running_ = false;
+    std::vector<std::thread> workers_;
+};
+
+// Fire-and-forget coroutine task. The frame starts eagerly on the caller
+// and destroys itself at completion; join() blocks until then so owners
+// can tear down safely in disconnect().
+class AsyncTask {
+public:
+    struct CompletionState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+    };
+
+    struct promise_type {
+        std::shared_ptr<CompletionState> state = std::make_shared<CompletionState>();
+
+        AsyncTask get_return_object() { return AsyncTask(state); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        auto final_suspend() noexcept {
+            struct Awaiter {
+                std::shared_ptr<CompletionState> state;
+                // Returning ready lets the frame destroy itself after we
+                // flag completion.
+                bool await_ready() noexcept {
+                    {
+                        std::lock_guard<std::mutex> lock(state->mutex);
+                        state->done = true;
+                    }
+                    state->cv.notify_all();
+                    return true;
+                }
+                void await_suspend(std::coroutine_handle<>) noexcept {}
+                void await_resume() noexcept {}
+            };
+            return Awaiter{state};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {
+            EVENT_LOG_ERROR("AsyncTask terminated by unhandled exception");
+        }
+    };
+
+    AsyncTask() = default;
+
+    void join() {
+        if (!state_) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->cv.wait(lock, [this]() { return state_->done; });
+    }
+
+    bool joinable() const { return state_ != nullptr; }
+
+private:
+    explicit AsyncTask(std::shared_ptr<CompletionState> state) : state_(std::move(state)) {}
+
+    std::shared_ptr<CompletionState> state_;
+};
+
+// Base for adapters whose work is an awaitable task on a shared executor
+// rather than a dedicated thread. Derived classes implement run_async()
+// as a coroutine (typically `co_await executor()->schedule()` first, then
+// loop while is_connected()); connect() launches it and disconnect()
+// joins it.
+class AsyncDataSourceAdapter : public DataSourceAdapter {
+public:
+    AsyncDataSourceAdapter(std::string name, std::shared_ptr<AsyncExecutor> executor)
+        : DataSourceAdapter(std::move(name))
+        , executor_(std::move(executor)) {}
+
+    void connect() override {
+        EVENT_LOG_INFO("Connecting async adapter '{}'", name());
+        running_ = true;
+        set_state(State::Connected);
+        task_ = run_async();
+    }
+
+    void disconnect() override {
+        EVENT_LOG_INFO("Disconnecting async adapter '{}'", name());
+        running_ = false;
+        executor_->wake_sleepers();
+        if (task_.joinable()) {
+            task_.join();
+            task_ = AsyncTask();
+        }
+        set_state(State::Disconnected);
+    }
+
+    bool is_connected() const override {
+        return running_.load();
+    }
+
+protected:
+    virtual AsyncTask run_async() = 0;
+
+    const std::shared_ptr<AsyncExecutor>& executor() const { return executor_; }
+
+private:
+    std::shared_ptr<AsyncExecutor> executor_;
+    std::atomic<bool> running_{false};
+    AsyncTask task_;
+};
+
+// Ports any PollingDataSourceAdapter subclass onto the executor: the
+// polling thread is replaced by a coroutine that polls and co_awaits the
+// interval, so hundreds of pollers share the executor's few threads.
+//
+//   auto executor = std::make_shared<AsyncExecutor>(4);
+//   AsyncPolling<adapters::JsonHttpAdapter> prices(executor, "prices", url,
+//                                                  std::chrono::seconds(1));
+//
+template<typename PollingAdapter>
+class AsyncPolling : public PollingAdapter {
+public:
+    template<typename... Args>
+    AsyncPolling(std::shared_ptr<AsyncExecutor> executor, Args&&... args)
+        : PollingAdapter(std::forward<Args>(args)...)
+        , executor_(std::move(executor)) {}
+
+    ~AsyncPolling() {
+        AsyncPolling::disconnect();
+    }
+
+    void connect() override {
+        EVENT_LOG_INFO("Connecting async polling adapter '{}'", this->name());
+        running_ = true;
+        this->set_state(DataSourceAdapter::State::Connected);
+        task_ = run();
+    }
+
+    void disconnect() override {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        EVENT_LOG_INFO("Disconnecting async polling adapter '{}'", this->name());
+        executor_->wake_sleepers();
+        if (task_.joinable()) {
+            task_.join();
+            task_ = AsyncTask();
+        }
+        this->set_state(DataSourceAdapter::State::Disconnected);
+    }
+
+    bool is_connected() const override {
+        return running_.load();
+    }
+
+private:
+    AsyncTask run() {
+        co_await executor_->schedule();
+        while (running_.load() && executor_->is_running()) {
+            try {
+                this->poll();
+            } catch (const std::exception& e) {
+                EVENT_LOG_ERROR("Polling error in async adapter '{}': {}", this->name(), e.what());
+            }
+            co_await executor_->sleep_for(this->polling_interval());
+        }
+    }
+
+    std::shared_ptr<AsyncExecutor> executor_;
+    std::atomic<bool> running_{false};
+    AsyncTask task_;
+};
+
+} // namespace event_adapter
+
+#endif // __cpp_impl_coroutine
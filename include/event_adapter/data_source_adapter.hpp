@@ -1,12 +1,15 @@
 #pragma once
 
 #include "event.hpp"
+#include "dispatcher_stats.hpp"
 #include "logging.hpp"
+#include "timer_wheel.hpp"
 #include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 #include <atomic>
+#include <mutex>
 #include <thread>
 #include <algorithm>
 
@@ -56,37 +59,78 @@ public:
     const std::string& name() const { return name_; }
     State state() const { return state_.load(); }
     
+    // Subscription is safe while the adapter is emitting: writers build a
+    // new immutable handler list under subscribers_mutex_ and publish it
+    // with one atomic store (copy-on-write); emit_event only does one
+    // atomic load to pick up the current snapshot.
     void subscribe(std::shared_ptr<EventHandler> handler) {
-        handlers_.push_back(handler);
-        EVENT_LOG_DEBUG("Handler subscribed to adapter '{}', total handlers: {}", name_, handlers_.size());
+        [[maybe_unused]] auto size = mutate_handlers([&](HandlerList& handlers) {
+            handlers.push_back(std::move(handler));
+        });
+        EVENT_LOG_DEBUG("Handler subscribed to adapter '{}', total handlers: {}", name_, size);
     }
     
     void subscribe(EventHandler::Callback callback) {
-        handlers_.push_back(std::make_shared<FunctionalEventHandler>(std::move(callback)));
-        EVENT_LOG_DEBUG("Callback subscribed to adapter '{}', total handlers: {}", name_, handlers_.size());
+        subscribe(std::make_shared<FunctionalEventHandler>(std::move(callback)));
     }
     
     void unsubscribe(std::shared_ptr<EventHandler> handler) {
-        auto prev_size = handlers_.size();
-        handlers_.erase(
-            std::remove(handlers_.begin(), handlers_.end(), handler),
-            handlers_.end()
-        );
-        EVENT_LOG_DEBUG("Handler unsubscribed from adapter '{}', handlers: {} -> {}", name_, prev_size, handlers_.size());
+        [[maybe_unused]] auto size = mutate_handlers([&](HandlerList& handlers) {
+            handlers.erase(
+                std::remove(handlers.begin(), handlers.end(), handler),
+                handlers.end()
+            );
+        });
+        EVENT_LOG_DEBUG("Handler unsubscribed from adapter '{}', handlers now: {}", name_, size);
     }
     
+    // Emits the adapter's cached state as one batched SnapshotEvent.
+    // Returns false when the adapter keeps no snapshotable state (the
+    // default); adapters with a cache override build_snapshot().
+    bool request_snapshot() {
+        SnapshotEvent snapshot;
+        snapshot.source = name_;
+        if (!build_snapshot(snapshot.entries)) {
+            return false;
+        }
+        EVENT_LOG_INFO("Adapter '{}' emitting snapshot with {} entries",
+                       name_, snapshot.entries.size());
+        emit<SnapshotEvent>(std::move(snapshot));
+        return true;
+    }
+
+    // Snapshot of emission counters and fan-out latency; safe to call from
+    // any thread while the adapter is emitting.
+    AdapterStats stats() const {
+        AdapterStats snap;
+        snap.events_emitted = events_emitted_.load(std::memory_order_relaxed);
+        snap.handler_errors = handler_errors_.load(std::memory_order_relaxed);
+        snap.fanout_time = fanout_hist_.snapshot();
+        return snap;
+    }
+
 protected:
     void emit_event(EventPtr event) {
         EVENT_LOG_TRACE("Adapter '{}' emitting event of type: {}", name_, event->type().name());
-        for (const auto& handler : handlers_) {
+        auto start = std::chrono::steady_clock::now();
+        events_emitted_.fetch_add(1, std::memory_order_relaxed);
+        // One atomic load pins the current snapshot; concurrent
+        // subscribe/unsubscribe publishes a fresh list without touching it.
+        auto handlers = std::atomic_load_explicit(&handlers_, std::memory_order_acquire);
+        if (!handlers) {
+            return;
+        }
+        for (const auto& handler : *handlers) {
             if (handler) {
                 try {
                     handler->handle(event);
                 } catch (const std::exception& e) {
+                    handler_errors_.fetch_add(1, std::memory_order_relaxed);
                     EVENT_LOG_ERROR("Handler exception in adapter '{}': {}", name_, e.what());
                 }
             }
         }
+        fanout_hist_.record(std::chrono::steady_clock::now() - start);
     }
     
     void set_state(State new_state) {
@@ -99,11 +143,38 @@ protected:
     void emit(Args&&... args) {
         emit_event(make_event<T>(std::forward<Args>(args)...));
     }
+
+    // Fill `entries` with the adapter's current state and return true;
+    // return false if there is nothing to snapshot.
+    virtual bool build_snapshot(std::vector<SnapshotEvent::Entry>& entries) {
+        (void)entries;
+        return false;
+    }
     
 private:
+    using HandlerList = std::vector<std::shared_ptr<EventHandler>>;
+
+    template<typename Mutation>
+    std::size_t mutate_handlers(Mutation&& mutation) {
+        std::lock_guard<std::mutex> lock(subscribers_mutex_);
+        auto current = std::atomic_load_explicit(&handlers_, std::memory_order_acquire);
+        auto updated = current ? std::make_shared<HandlerList>(*current)
+                               : std::make_shared<HandlerList>();
+        mutation(*updated);
+        std::size_t size = updated->size();
+        std::atomic_store_explicit(&handlers_,
+                                   std::shared_ptr<const HandlerList>(std::move(updated)),
+                                   std::memory_order_release);
+        return size;
+    }
+
     std::string name_;
     std::atomic<State> state_;
-    std::vector<std::shared_ptr<EventHandler>> handlers_;
+    std::mutex subscribers_mutex_;
+    std::shared_ptr<const HandlerList> handlers_;
+    std::atomic<std::uint64_t> events_emitted_{0};
+    std::atomic<std::uint64_t> handler_errors_{0};
+    LatencyHistogram fanout_hist_;
 };
 
 template<typename SourceType>
@@ -123,6 +194,16 @@ public:
         : DataSourceAdapter(std::move(name))
         , polling_interval_(interval)
         , should_poll_(false) {}
+
+    // Registers against a shared timer wheel instead of owning a polling
+    // thread: all adapters sharing the wheel are multiplexed onto its one
+    // worker thread. Pass the same wheel to every polling adapter.
+    PollingDataSourceAdapter(std::string name, std::chrono::milliseconds interval,
+                             std::shared_ptr<TimerWheelService> timer_wheel)
+        : DataSourceAdapter(std::move(name))
+        , polling_interval_(interval)
+        , should_poll_(false)
+        , timer_wheel_(std::move(timer_wheel)) {}
     
     void connect() override {
         EVENT_LOG_INFO("Connecting polling adapter '{}' with interval {}ms", name(), polling_interval_.count());
@@ -144,8 +225,23 @@ public:
     
 protected:
     virtual void poll() = 0;
+
+    std::chrono::milliseconds polling_interval() const { return polling_interval_; }
     
     void start_polling() {
+        if (timer_wheel_) {
+            timer_id_ = timer_wheel_->schedule_periodic(polling_interval_, [this]() {
+                if (!should_poll_.load()) {
+                    return;
+                }
+                try {
+                    poll();
+                } catch (const std::exception& e) {
+                    EVENT_LOG_ERROR("Polling error in adapter '{}': {}", name(), e.what());
+                }
+            });
+            return;
+        }
         polling_thread_ = std::thread([this]() {
             EVENT_LOG_DEBUG("Polling thread started for adapter '{}'", name());
             while (should_poll_.load()) {
@@ -162,6 +258,11 @@ protected:
     
     void stop_polling() {
         should_poll_ = false;
+        if (timer_wheel_ && timer_id_ != 0) {
+            timer_wheel_->cancel(timer_id_);
+            timer_id_ = 0;
+            return;
+        }
         if (polling_thread_.joinable()) {
             EVENT_LOG_DEBUG("Waiting for polling thread to finish for adapter '{}'", name());
             polling_thread_.join();
@@ -172,6 +273,8 @@ private:
     std::chrono::milliseconds polling_interval_;
     std::atomic<bool> should_poll_;
     std::thread polling_thread_;
+    std::shared_ptr<TimerWheelService> timer_wheel_;
+    TimerWheelService::TimerId timer_id_ = 0;
 };
 
 } // namespace event_adapter
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace event_adapter {
+
+// Lightweight always-on instrumentation primitives. All hot-path writes
+// are single relaxed atomic increments, so recording stays well under 1%
+// of event cost and can be left enabled in production; snapshots are read
+// from any other thread without stopping the writers.
+
+// Fixed 64-bucket log2 latency histogram: bucket i counts samples in
+// [2^i, 2^(i+1)) nanoseconds. Coarser than HDR at the top end but two
+// instructions to record and trivially snapshotable.
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kBuckets = 64;
+
+    struct Snapshot {
+        std::array<std::uint64_t, kBuckets> buckets{};
+        std::uint64_t count = 0;
+
+        // Upper bound (ns) of the bucket containing the given percentile.
+        std::uint64_t value_at_percentile(double percentile) const {
+            if (count == 0) {
+                return 0;
+            }
+            std::uint64_t rank = static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(count));
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < kBuckets; ++i) {
+                seen += buckets[i];
+                if (seen > rank) {
+                    return i >= 63 ? ~std::uint64_t{0} : (std::uint64_t{2} << i);
+                }
+            }
+            return ~std::uint64_t{0};
+        }
+    };
+
+    void record(std::chrono::nanoseconds latency) {
+        std::uint64_t ns = latency.count() <= 0 ? 1 : static_cast<std::uint64_t>(latency.count());
+        buckets_[bucket_for(ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Snapshot snapshot() const {
+        Snapshot snap;
+        for (std::size_t i = 0; i < kBuckets; ++i) {
+            snap.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+            snap.count += snap.buckets[i];
+        }
+        return snap;
+    }
+
+private:
+    static std::size_t bucket_for(std::uint64_t ns) {
+        std::size_t bucket = 0;
+        while (ns >>= 1) {
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{};
+};
+
+// Per-event-type counters; owned by the dispatcher's processor table and
+// bumped in place on the processing path.
+struct EventTypeCounters {
+    std::atomic<std::uint64_t> processed{0};
+    std::atomic<std::uint64_t> errors{0};
+};
+
+// Point-in-time view of a dispatcher's activity.
+struct DispatcherStats {
+    std::uint64_t dispatched = 0;
+    std::uint64_t processed = 0;
+    std::uint64_t unhandled = 0;
+    std::uint64_t errors = 0;
+    std::uint64_t dropped = 0;    // overflow-policy rejections/evictions
+    std::uint64_t coalesced = 0;  // superseded same-key DataUpdateEvents
+    LatencyHistogram::Snapshot queue_wait;    // enqueue -> dequeue
+    LatencyHistogram::Snapshot handler_time;  // processor execution
+    std::unordered_map<std::string, std::uint64_t> processed_by_type;
+};
+
+// Point-in-time view of an adapter's emission activity.
+struct AdapterStats {
+    std::uint64_t events_emitted = 0;
+    std::uint64_t handler_errors = 0;
+    LatencyHistogram::Snapshot fanout_time;  // emit_event including all handlers
+};
+
+} // namespace event_adapter
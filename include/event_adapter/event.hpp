@@ -3,19 +3,102 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <typeindex>
+#include <utility>
 #include <variant>
+#include <vector>
 #include <any>
 #include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace event_adapter {
 
 using EventTimestamp = std::chrono::steady_clock::time_point;
 using EventId = std::uint64_t;
 
+// Timestamp source for Event construction. By default every event reads
+// steady_clock::now(); enable_coarse() starts a ticker thread that
+// refreshes a relaxed atomic at the given resolution, turning the
+// per-event cost into one uncontended load. Use it on hot producer paths
+// where timestamps only need ticker-resolution accuracy (queue-wait and
+// latency stats still use steady_clock directly).
+class EventClock {
+public:
+    static EventTimestamp now() {
+        auto ns = coarse_ns().load(std::memory_order_relaxed);
+        if (ns != 0) {
+            return EventTimestamp(std::chrono::nanoseconds(ns));
+        }
+        return std::chrono::steady_clock::now();
+    }
+
+    static void enable_coarse(std::chrono::milliseconds resolution = std::chrono::milliseconds(1)) {
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (s.running.load()) {
+            return;
+        }
+        s.running.store(true);
+        coarse_ns().store(steady_ns(), std::memory_order_relaxed);
+        s.ticker = std::thread([resolution]() {
+            State& s = state();
+            while (s.running.load(std::memory_order_relaxed)) {
+                coarse_ns().store(steady_ns(), std::memory_order_relaxed);
+                std::this_thread::sleep_for(resolution);
+            }
+        });
+    }
+
+    static void disable_coarse() {
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (!s.running.exchange(false)) {
+            return;
+        }
+        if (s.ticker.joinable()) {
+            s.ticker.join();
+        }
+        coarse_ns().store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::atomic<bool> running{false};
+        std::thread ticker;
+
+        // Normal process exit must not destroy a joinable thread; stop
+        // the ticker here so callers that never pair enable_coarse()
+        // with disable_coarse() still shut down cleanly.
+        ~State() {
+            running.store(false);
+            if (ticker.joinable()) {
+                ticker.join();
+            }
+        }
+    };
+
+    static std::int64_t steady_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static State& state() {
+        static State s;
+        return s;
+    }
+
+    static std::atomic<std::int64_t>& coarse_ns() {
+        static std::atomic<std::int64_t> ns{0};
+        return ns;
+    }
+};
+
 class Event {
 public:
-    Event() : id_(generate_id()), timestamp_(std::chrono::steady_clock::now()) {}
+    Event() : id_(generate_id()), timestamp_(EventClock::now()) {}
     
     virtual ~Event() = default;
     
@@ -26,9 +109,20 @@ public:
     virtual std::string name() const = 0;
     
 protected:
+    // Each thread claims a block of IDs with one shared fetch_add and then
+    // hands them out from plain thread-local increments, so producers stop
+    // ping-ponging the counter's cache line. IDs stay process-unique but
+    // are only ordered within a thread.
     static EventId generate_id() {
         static std::atomic<EventId> counter{0};
-        return counter.fetch_add(1, std::memory_order_relaxed);
+        constexpr EventId kIdBlockSize = 1024;
+        thread_local EventId next = 0;
+        thread_local EventId block_end = 0;
+        if (next == block_end) {
+            next = counter.fetch_add(kIdBlockSize, std::memory_order_relaxed);
+            block_end = next + kIdBlockSize;
+        }
+        return next++;
     }
     
 private:
@@ -61,6 +155,56 @@ private:
 template<typename... Events>
 using EventVariant = std::variant<Events...>;
 
+// Refcounted immutable byte buffer for zero-copy payloads. The buffer
+// holds a shared owner (whatever object keeps the bytes alive) plus a
+// data/size window into it, so a multi-megabyte HTTP or WebSocket body can
+// travel through the event path without being copied per hop. Copying a
+// SharedBuffer only bumps the owner's refcount.
+class SharedBuffer {
+public:
+    SharedBuffer() = default;
+
+    // Take ownership of a string's storage without copying it.
+    static SharedBuffer take(std::string&& body) {
+        auto owner = std::make_shared<const std::string>(std::move(body));
+        const std::string& stored = *owner;
+        return SharedBuffer(std::move(owner), stored.data(), stored.size());
+    }
+
+    // Make an owned copy (for callers that only have a view).
+    static SharedBuffer copy_of(std::string_view body) {
+        return take(std::string(body));
+    }
+
+    // Wrap an externally-owned region; `owner` must keep `data` alive
+    // (e.g. the websocketpp message holding its payload).
+    static SharedBuffer view_of(std::shared_ptr<const void> owner, const char* data, std::size_t size) {
+        return SharedBuffer(std::move(owner), data, size);
+    }
+
+    const char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    std::string_view view() const { return {data_, size_}; }
+
+private:
+    SharedBuffer(std::shared_ptr<const void> owner, const char* data, std::size_t size)
+        : owner_(std::move(owner)), data_(data), size_(size) {}
+
+    std::shared_ptr<const void> owner_;
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// Binary-buffer counterpart to DataUpdateEvent: the payload is a shared
+// view of the original response/frame rather than a std::any copy of it.
+struct RawDataEvent {
+    std::string source;
+    std::string key;
+    SharedBuffer buffer;
+};
+
 struct DataUpdateEvent {
     std::string source;
     std::string key;
@@ -68,6 +212,25 @@ struct DataUpdateEvent {
     std::any previous_value;
 };
 
+// Typed counterpart to DataUpdateEvent: the payload is a concrete T
+// instead of std::any, so small values (double, int64) are stored inline
+// with no heap allocation on construction and no any_cast/RTTI on read —
+// consumers access .value directly. Use this when producer and consumer
+// agree on the value type; DataUpdateEvent remains for heterogeneous or
+// dynamically-typed streams.
+template<typename T>
+struct TypedDataUpdateEvent {
+    std::string source;
+    std::string key;
+    T value{};
+    T previous_value{};
+};
+
+// The common market-data shapes.
+using NumericUpdateEvent = TypedDataUpdateEvent<double>;
+using IntegerUpdateEvent = TypedDataUpdateEvent<std::int64_t>;
+using StringUpdateEvent = TypedDataUpdateEvent<std::string>;
+
 struct ConnectionEvent {
     enum class Type { Connected, Disconnected, Error };
     Type type;
@@ -80,6 +243,19 @@ struct HeartbeatEvent {
     std::chrono::milliseconds interval;
 };
 
+// Batched dump of an adapter's current state, emitted by
+// request_snapshot(): one event carrying every cached (key, value) pair
+// instead of thousands of individual DataUpdateEvents, so cold-starting
+// consumers reach warm state in a single dispatch.
+struct SnapshotEvent {
+    struct Entry {
+        std::string key;
+        std::any value;
+    };
+    std::string source;
+    std::vector<Entry> entries;
+};
+
 using EventPtr = std::shared_ptr<Event>;
 
 template<typename T, typename... Args>
@@ -2,8 +2,11 @@
 
 #include "event.hpp"
 #include "data_source_adapter.hpp"
+#include "dispatcher_stats.hpp"
 #include "logging.hpp"
+#include "mpsc_queue.hpp"
 #include <boost/sml.hpp>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <queue>
@@ -14,15 +17,81 @@
 #include <thread>
 #include <atomic>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace event_adapter {
 
 template<typename StateMachine>
 class EventDispatcher {
 public:
     using EventProcessor = std::function<void(EventPtr, StateMachine&)>;
-    
-    explicit EventDispatcher(StateMachine& sm) : state_machine_(sm), running_(false) {
-        EVENT_LOG_DEBUG("EventDispatcher created");
+
+    // Locked: unbounded std::queue guarded by queue_mutex_ (the default).
+    // LockFree: bounded MPSC ring; producers never take the mutex and the
+    // condition variable is only used once the consumer has gone idle.
+    enum class QueueMode {
+        Locked,
+        LockFree
+    };
+
+    // Dispatch lanes. High-lane events (control plane: reconnects,
+    // supervision) overtake queued bulk data; Low is for traffic that may
+    // always yield. Unregistered types ride Normal. Lanes apply to the
+    // locked queue; the lock-free ring stays a single FIFO.
+    enum class EventPriority {
+        High,
+        Normal,
+        Low
+    };
+
+    // How the processor thread waits when the queue is empty. Park (the
+    // default) uses the condition variable and costs a wakeup (~10-50µs)
+    // per idle/busy transition; SpinYield spins briefly then yields in a
+    // loop, never parking; BusySpin burns the core for the lowest wakeup
+    // latency — use it only on a dedicated, pinned core.
+    enum class WaitStrategy {
+        Park,
+        SpinYield,
+        BusySpin
+    };
+
+    // Placement of the processor thread for pinned deployments. Applied
+    // at start(); SCHED_FIFO requires CAP_SYS_NICE and is opt-in.
+    struct ThreadConfig {
+        int cpu_affinity = -1;        // core to pin to, -1 = unpinned
+        bool use_sched_fifo = false;
+        int fifo_priority = 1;
+        std::string thread_name;      // pthread name, truncated to 15 chars
+    };
+
+    // What dispatch() does when the queue is at capacity. CoalesceByKey
+    // applies to DataUpdateEvents continuously, not just at capacity: a
+    // pending update for the same (source, key) is superseded in place, so
+    // burst memory stays proportional to the number of distinct keys.
+    enum class OverflowPolicy {
+        Block,        // producer waits for space (the lock-free ring's default)
+        DropNewest,   // reject the incoming event
+        DropOldest,   // evict the oldest queued event
+        CoalesceByKey // supersede same-key DataUpdateEvents; otherwise DropOldest
+    };
+
+    explicit EventDispatcher(StateMachine& sm,
+                             QueueMode queue_mode = QueueMode::Locked,
+                             std::size_t queue_capacity = 65536)
+        : state_machine_(sm)
+        , queue_mode_(queue_mode)
+        , running_(false) {
+        if (queue_mode_ == QueueMode::LockFree) {
+            ring_queue_ = std::make_unique<MpscRingQueue<QueuedEvent>>(queue_capacity);
+        }
+        // Connection state changes drive reconnect decisions and should
+        // never sit behind bulk data; override with set_event_priority.
+        priorities_[std::type_index(typeid(ConnectionEvent))] = EventPriority::High;
+        EVENT_LOG_DEBUG("EventDispatcher created (queue mode: {})",
+                        queue_mode_ == QueueMode::LockFree ? "lock-free" : "locked");
     }
     
     ~EventDispatcher() {
@@ -30,14 +99,74 @@ public:
         stop();
     }
     
+    // Bound the locked queue to `capacity` events (0 = unbounded, the
+    // default). For the lock-free ring the capacity is fixed at
+    // construction; only Block and DropNewest are honored there.
+    void set_queue_limit(std::size_t capacity, OverflowPolicy policy = OverflowPolicy::Block) {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_capacity_ = capacity;
+        overflow_policy_ = policy;
+        if (queue_mode_ == QueueMode::LockFree &&
+            (policy == OverflowPolicy::DropOldest || policy == OverflowPolicy::CoalesceByKey)) {
+            EVENT_LOG_WARN("OverflowPolicy not supported for lock-free queue, using Block");
+            overflow_policy_ = OverflowPolicy::Block;
+        }
+    }
+
+    // Call before start().
+    void set_thread_config(ThreadConfig config) {
+        thread_config_ = std::move(config);
+    }
+
+    void set_wait_strategy(WaitStrategy strategy) {
+        wait_strategy_ = strategy;
+    }
+
+    // Invoked (on the producer thread, outside the queue lock) when the
+    // queue size crosses the watermark from below; re-arms once the
+    // consumer drains the queue. Lets adapters throttle before overflow
+    // policies kick in.
+    void set_high_watermark(std::size_t watermark, std::function<void(std::size_t)> callback) {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        high_watermark_ = watermark;
+        watermark_callback_ = std::move(callback);
+    }
+
     template<typename EventType>
     void register_event_processor(std::function<void(const EventType&, StateMachine&)> processor) {
         EVENT_LOG_DEBUG("Registering event processor for type: {}", typeid(EventType).name());
-        processors_[std::type_index(typeid(EventType))] = [processor](EventPtr event, StateMachine& sm) {
+        auto& entry = processors_[std::type_index(typeid(EventType))];
+        entry.processor = [processor](EventPtr event, StateMachine& sm) {
             if (auto typed_event = std::dynamic_pointer_cast<TypedEvent<EventType>>(event)) {
                 processor(typed_event->data(), sm);
             }
         };
+        entry.type_name = typeid(EventType).name();
+        if (!entry.counters) {
+            entry.counters = std::make_unique<EventTypeCounters>();
+        }
+    }
+
+    template<typename EventType>
+    void register_event_processor(std::function<void(const EventType&, StateMachine&)> processor,
+                                  EventPriority priority) {
+        register_event_processor<EventType>(std::move(processor));
+        set_event_priority<EventType>(priority);
+    }
+
+    // Lane assignment for a type; register before start(), like
+    // processors. Types without an assignment ride Normal.
+    template<typename EventType>
+    void set_event_priority(EventPriority priority) {
+        priorities_[std::type_index(typeid(EventType))] = priority;
+    }
+
+    // While draining the normal/low lanes the high lane is re-checked
+    // every `ratio` processed events, so control-plane events bypass a
+    // long bulk backlog without waiting for the drain to finish. Lower
+    // lanes can't starve: every queued event is processed each cycle.
+    void set_priority_ratio(std::size_t ratio) {
+        high_check_interval_ = ratio == 0 ? 1 : ratio;
     }
     
     template<typename EventType, typename SMEvent>
@@ -56,12 +185,71 @@ public:
     
     void dispatch(EventPtr event) {
         EVENT_LOG_TRACE("Dispatching event of type: {}", event->type().name());
+        dispatched_.fetch_add(1, std::memory_order_relaxed);
+        QueuedEvent queued{std::move(event), std::chrono::steady_clock::now()};
+        if (queue_mode_ == QueueMode::LockFree) {
+            if (!ring_queue_->try_push(std::move(queued))) {
+                if (overflow_policy_ == OverflowPolicy::DropNewest) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                // Block: spin until a slot frees up; a full ring means the
+                // consumer is the bottleneck.
+                while (!ring_queue_->try_push(std::move(queued))) {
+                    std::this_thread::yield();
+                }
+            }
+            // Only pay for the mutex+notify when the consumer has parked.
+            if (consumer_idle_.load(std::memory_order_acquire)) {
+                std::lock_guard<std::mutex> lock(queue_mutex_);
+                queue_cv_.notify_one();
+            }
+            return;
+        }
+        std::size_t watermark_size = 0;
+        auto priority_it = priorities_.find(queued.event->type());
+        EventPriority lane = priority_it == priorities_.end() ? EventPriority::Normal
+                                                              : priority_it->second;
         {
-            std::lock_guard<std::mutex> lock(queue_mutex_);
-            event_queue_.push(event);
-            EVENT_LOG_TRACE("Event queued, queue size: {}", event_queue_.size());
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            if (overflow_policy_ == OverflowPolicy::CoalesceByKey && try_coalesce(queued)) {
+                return;
+            }
+            if (queue_capacity_ != 0 && total_queued_locked() >= queue_capacity_) {
+                switch (overflow_policy_) {
+                case OverflowPolicy::Block:
+                    not_full_cv_.wait(lock, [this]() {
+                        return total_queued_locked() < queue_capacity_ || !running_;
+                    });
+                    break;
+                case OverflowPolicy::DropNewest:
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                case OverflowPolicy::DropOldest:
+                case OverflowPolicy::CoalesceByKey:
+                    drop_oldest_locked();
+                    break;
+                }
+            }
+            if (overflow_policy_ == OverflowPolicy::CoalesceByKey) {
+                index_for_coalescing(queued);
+            }
+            auto& queue = lane_locked(lane);
+            queue.push_back(std::move(queued));
+            if (!pending_index_key_.empty()) {
+                pending_by_key_[pending_index_key_] = &queue.back();
+                pending_index_key_.clear();
+            }
+            EVENT_LOG_TRACE("Event queued, queue size: {}", total_queued_locked());
+            if (high_watermark_ != 0 && !above_watermark_ && total_queued_locked() >= high_watermark_) {
+                above_watermark_ = true;
+                watermark_size = total_queued_locked();
+            }
         }
         queue_cv_.notify_one();
+        if (watermark_size != 0 && watermark_callback_) {
+            watermark_callback_(watermark_size);
+        }
     }
     
     void start() {
@@ -70,6 +258,7 @@ public:
         processor_thread_ = std::thread([this]() {
             process_events();
         });
+        apply_thread_config();
         EVENT_LOG_INFO("EventDispatcher started");
     }
     
@@ -80,6 +269,7 @@ public:
             running_ = false;
         }
         queue_cv_.notify_all();
+        not_full_cv_.notify_all();
         
         if (processor_thread_.joinable()) {
             EVENT_LOG_DEBUG("Waiting for processor thread to finish");
@@ -89,53 +279,359 @@ public:
     }
     
     size_t queue_size() const {
+        if (queue_mode_ == QueueMode::LockFree) {
+            return ring_queue_->size_approx();
+        }
         std::lock_guard<std::mutex> lock(queue_mutex_);
-        return event_queue_.size();
+        return total_queued_locked();
     }
-    
+
+    // Snapshot of hot-path counters and histograms; safe to call from any
+    // thread while the dispatcher is running. Per-type counts reflect
+    // processors registered before start().
+    DispatcherStats stats() const {
+        DispatcherStats snap;
+        snap.dispatched = dispatched_.load(std::memory_order_relaxed);
+        snap.processed = processed_.load(std::memory_order_relaxed);
+        snap.unhandled = unhandled_.load(std::memory_order_relaxed);
+        snap.errors = errors_.load(std::memory_order_relaxed);
+        snap.dropped = dropped_.load(std::memory_order_relaxed);
+        snap.coalesced = coalesced_.load(std::memory_order_relaxed);
+        snap.queue_wait = queue_wait_hist_.snapshot();
+        snap.handler_time = handler_time_hist_.snapshot();
+        for (const auto& [type, entry] : processors_) {
+            snap.processed_by_type[entry.type_name] =
+                entry.counters->processed.load(std::memory_order_relaxed);
+        }
+        return snap;
+    }
+
 private:
+    struct QueuedEvent {
+        EventPtr event;
+        EventTimestamp enqueued_at{};
+    };
+
+    struct ProcessorEntry {
+        EventProcessor processor;
+        std::string type_name;
+        std::unique_ptr<EventTypeCounters> counters;
+    };
+
     void process_events() {
         EVENT_LOG_DEBUG("Event processing thread started");
+        if (queue_mode_ == QueueMode::LockFree) {
+            process_events_lockfree();
+        } else {
+            process_events_locked();
+        }
+        EVENT_LOG_DEBUG("Event processing thread exiting");
+    }
+
+    void process_events_locked() {
+        std::deque<QueuedEvent> high_batch;
+        std::deque<QueuedEvent> batch;
+        std::deque<QueuedEvent> low_batch;
         while (running_) {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            queue_cv_.wait(lock, [this]() { return !event_queue_.empty() || !running_; });
-            
-            while (!event_queue_.empty()) {
-                auto event = event_queue_.front();
-                event_queue_.pop();
-                EVENT_LOG_TRACE("Processing event from queue, remaining: {}", event_queue_.size());
-                lock.unlock();
-                
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                if (wait_strategy_ == WaitStrategy::Park) {
+                    queue_cv_.wait(lock, [this]() { return total_queued_locked() != 0 || !running_; });
+                } else {
+                    // Spin strategies poll the queue without parking, so a
+                    // producer's notify never has to wake the kernel.
+                    int spins = 0;
+                    while (total_queued_locked() == 0 && running_) {
+                        lock.unlock();
+                        idle_wait(spins);
+                        lock.lock();
+                    }
+                }
+                // Swap the whole pending lanes out under a single lock
+                // acquisition; the batches are then processed mutex-free.
+                high_batch.swap(high_queue_);
+                batch.swap(event_queue_);
+                low_batch.swap(low_queue_);
+                pending_by_key_.clear();
+                above_watermark_ = false;
+            }
+            not_full_cv_.notify_all();
+            EVENT_LOG_TRACE("Draining batch of {}/{}/{} events (high/normal/low)",
+                            high_batch.size(), batch.size(), low_batch.size());
+            drain_batches(high_batch, batch, low_batch);
+        }
+        // Process anything enqueued between the last drain and stop().
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        high_batch.swap(high_queue_);
+        batch.swap(event_queue_);
+        low_batch.swap(low_queue_);
+        pending_by_key_.clear();
+        lock.unlock();
+        not_full_cv_.notify_all();
+        drain_batches(high_batch, batch, low_batch);
+    }
+
+    // High first; while working through normal/low, re-poll the high lane
+    // every high_check_interval_ events so late-arriving control-plane
+    // events don't wait out the whole backlog.
+    void drain_batches(std::deque<QueuedEvent>& high_batch,
+                       std::deque<QueuedEvent>& batch,
+                       std::deque<QueuedEvent>& low_batch) {
+        for (const auto& queued : high_batch) {
+            process_event(queued);
+        }
+        high_batch.clear();
+        std::size_t since_high_check = 0;
+        for (auto* lane : {&batch, &low_batch}) {
+            for (const auto& queued : *lane) {
+                process_event(queued);
+                if (++since_high_check >= high_check_interval_) {
+                    since_high_check = 0;
+                    {
+                        std::lock_guard<std::mutex> lock(queue_mutex_);
+                        high_batch.swap(high_queue_);
+                        // Drop index entries pointing into the swapped-out
+                        // batch so a later coalesce can't write through
+                        // them (mirrors the full-drain swap).
+                        std::string key;
+                        for (const auto& high : high_batch) {
+                            if (coalesce_key(high.event, key)) {
+                                pending_by_key_.erase(key);
+                            }
+                        }
+                    }
+                    for (const auto& high : high_batch) {
+                        process_event(high);
+                    }
+                    high_batch.clear();
+                }
+            }
+            lane->clear();
+        }
+    }
+
+    void process_events_lockfree() {
+        constexpr int kIdleSpins = 4096;
+        QueuedEvent event;
+        while (running_) {
+            if (ring_queue_->try_pop(event)) {
                 process_event(event);
-                
-                lock.lock();
+                event.event.reset();
+                continue;
             }
+            // Spin briefly before parking so bursts never hit the condvar.
+            bool got_one = false;
+            for (int i = 0; i < kIdleSpins && running_; ++i) {
+                if (ring_queue_->try_pop(event)) {
+                    got_one = true;
+                    break;
+                }
+            }
+            if (got_one) {
+                process_event(event);
+                event.event.reset();
+                continue;
+            }
+            if (wait_strategy_ != WaitStrategy::Park) {
+                int spins = kIdleSpins;
+                idle_wait(spins);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            consumer_idle_.store(true, std::memory_order_release);
+            // Short timed wait covers the window where a producer pushed
+            // just before seeing consumer_idle_ set.
+            queue_cv_.wait_for(lock, std::chrono::milliseconds(1), [this]() {
+                return ring_queue_->size_approx() != 0 || !running_;
+            });
+            consumer_idle_.store(false, std::memory_order_release);
+        }
+        // Drain anything left behind so stop() doesn't drop queued events.
+        while (ring_queue_->try_pop(event)) {
+            process_event(event);
+            event.event.reset();
         }
-        EVENT_LOG_DEBUG("Event processing thread exiting");
     }
     
-    void process_event(EventPtr event) {
+    // One step of a spin strategy: BusySpin only relaxes the pipeline;
+    // SpinYield relaxes for the first kSpinsBeforeYield steps, then
+    // yields the slice.
+    void idle_wait(int& spins) const {
+        constexpr int kSpinsBeforeYield = 4096;
+        if (wait_strategy_ == WaitStrategy::BusySpin || spins++ < kSpinsBeforeYield) {
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    static void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+    void apply_thread_config() {
+#ifdef __linux__
+        auto handle = processor_thread_.native_handle();
+        if (thread_config_.cpu_affinity >= 0) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(thread_config_.cpu_affinity, &cpus);
+            if (pthread_setaffinity_np(handle, sizeof(cpus), &cpus) != 0) {
+                EVENT_LOG_WARN("Failed to pin dispatcher thread to core {}",
+                               thread_config_.cpu_affinity);
+            }
+        }
+        if (thread_config_.use_sched_fifo) {
+            sched_param param{};
+            param.sched_priority = thread_config_.fifo_priority;
+            if (pthread_setschedparam(handle, SCHED_FIFO, &param) != 0) {
+                EVENT_LOG_WARN("Failed to set SCHED_FIFO on dispatcher thread "
+                               "(needs CAP_SYS_NICE)");
+            }
+        }
+        if (!thread_config_.thread_name.empty()) {
+            pthread_setname_np(handle, thread_config_.thread_name.substr(0, 15).c_str());
+        }
+#else
+        if (thread_config_.cpu_affinity >= 0 || thread_config_.use_sched_fifo ||
+            !thread_config_.thread_name.empty()) {
+            EVENT_LOG_WARN("Thread configuration is only applied on Linux");
+        }
+#endif
+    }
+
+    // Key for coalescing; only DataUpdateEvents participate.
+    static bool coalesce_key(const EventPtr& event, std::string& key) {
+        if (event->type() != std::type_index(typeid(DataUpdateEvent))) {
+            return false;
+        }
+        const auto& data = std::static_pointer_cast<TypedEvent<DataUpdateEvent>>(event)->data();
+        key.assign(data.source);
+        key.push_back('\0');
+        key.append(data.key);
+        return true;
+    }
+
+    // Supersede a pending same-key update in place. Deque pointers stay
+    // valid across push_back, and the index is cleared whenever the queue
+    // is swapped out or an entry is evicted.
+    bool try_coalesce(QueuedEvent& queued) {
+        std::string key;
+        if (!coalesce_key(queued.event, key)) {
+            return false;
+        }
+        auto it = pending_by_key_.find(key);
+        if (it == pending_by_key_.end()) {
+            return false;
+        }
+        *it->second = std::move(queued);
+        coalesced_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void index_for_coalescing(const QueuedEvent& queued) {
+        std::string key;
+        if (coalesce_key(queued.event, key)) {
+            // push_back happens right after; the slot is the future back().
+            pending_index_key_ = std::move(key);
+        } else {
+            pending_index_key_.clear();
+        }
+    }
+
+    // Evicts from the least important non-empty lane.
+    void drop_oldest_locked() {
+        auto* queue = !low_queue_.empty() ? &low_queue_
+                      : !event_queue_.empty() ? &event_queue_
+                      : !high_queue_.empty() ? &high_queue_
+                      : nullptr;
+        if (!queue) {
+            return;
+        }
+        std::string key;
+        if (coalesce_key(queue->front().event, key)) {
+            pending_by_key_.erase(key);
+        }
+        queue->pop_front();
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t total_queued_locked() const {
+        return high_queue_.size() + event_queue_.size() + low_queue_.size();
+    }
+
+    std::deque<QueuedEvent>& lane_locked(EventPriority lane) {
+        switch (lane) {
+        case EventPriority::High: return high_queue_;
+        case EventPriority::Low: return low_queue_;
+        case EventPriority::Normal: break;
+        }
+        return event_queue_;
+    }
+
+    void process_event(const QueuedEvent& queued) {
+        auto now = std::chrono::steady_clock::now();
+        queue_wait_hist_.record(now - queued.enqueued_at);
+
+        const EventPtr& event = queued.event;
         auto it = processors_.find(event->type());
         if (it != processors_.end()) {
             EVENT_LOG_TRACE("Processing event with registered handler: {}", event->type().name());
+            auto& entry = it->second;
             try {
-                it->second(event, state_machine_);
+                entry.processor(event, state_machine_);
+                entry.counters->processed.fetch_add(1, std::memory_order_relaxed);
+                processed_.fetch_add(1, std::memory_order_relaxed);
             } catch (const std::exception& e) {
+                entry.counters->errors.fetch_add(1, std::memory_order_relaxed);
+                errors_.fetch_add(1, std::memory_order_relaxed);
                 EVENT_LOG_ERROR("Exception processing event {}: {}", event->type().name(), e.what());
             }
+            handler_time_hist_.record(std::chrono::steady_clock::now() - now);
         } else {
+            unhandled_.fetch_add(1, std::memory_order_relaxed);
             EVENT_LOG_WARN("No processor registered for event type: {}", event->type().name());
         }
     }
     
     StateMachine& state_machine_;
-    std::unordered_map<std::type_index, EventProcessor> processors_;
-    
+    std::unordered_map<std::type_index, ProcessorEntry> processors_;
+
+    QueueMode queue_mode_;
     mutable std::mutex queue_mutex_;
     std::condition_variable queue_cv_;
-    std::queue<EventPtr> event_queue_;
+    std::condition_variable not_full_cv_;
+    std::deque<QueuedEvent> high_queue_;
+    std::deque<QueuedEvent> event_queue_;
+    std::deque<QueuedEvent> low_queue_;
+    std::unordered_map<std::type_index, EventPriority> priorities_;
+    std::size_t high_check_interval_ = 16;
+    std::size_t queue_capacity_ = 0;  // 0 = unbounded (locked mode)
+    OverflowPolicy overflow_policy_ = OverflowPolicy::Block;
+    std::unordered_map<std::string, QueuedEvent*> pending_by_key_;
+    std::string pending_index_key_;
+    std::size_t high_watermark_ = 0;
+    std::function<void(std::size_t)> watermark_callback_;
+    bool above_watermark_ = false;
+    std::unique_ptr<MpscRingQueue<QueuedEvent>> ring_queue_;
+    std::atomic<bool> consumer_idle_{false};
+    WaitStrategy wait_strategy_ = WaitStrategy::Park;
+    ThreadConfig thread_config_;
     std::atomic<bool> running_;
     std::thread processor_thread_;
+
+    std::atomic<std::uint64_t> dispatched_{0};
+    std::atomic<std::uint64_t> processed_{0};
+    std::atomic<std::uint64_t> unhandled_{0};
+    std::atomic<std::uint64_t> errors_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> coalesced_{0};
+    LatencyHistogram queue_wait_hist_;
+    LatencyHistogram handler_time_hist_;
 };
 
 template<typename SM>
@@ -156,12 +652,17 @@ public:
     }
 };
 
-template<typename StateMachine>
+// DispatcherType can be any dispatcher with the dispatch()/start()/stop()
+// surface (EventDispatcher, ShardedEventDispatcher, ...); extra constructor
+// arguments are forwarded to it after the state machine.
+template<typename StateMachine, typename DispatcherType = EventDispatcher<StateMachine>>
 class EventAdapterSystem {
 public:
-    using Dispatcher = EventDispatcher<StateMachine>;
-    
-    EventAdapterSystem(StateMachine& sm) : dispatcher_(sm) {
+    using Dispatcher = DispatcherType;
+
+    template<typename... DispatcherArgs>
+    EventAdapterSystem(StateMachine& sm, DispatcherArgs&&... args)
+        : dispatcher_(sm, std::forward<DispatcherArgs>(args)...) {
         EVENT_LOG_INFO("EventAdapterSystem created");
     }
     
@@ -177,6 +678,11 @@ public:
         EVENT_LOG_INFO("Starting EventAdapterSystem");
         dispatcher_.start();
         for (auto& adapter : adapters_) {
+            // Snapshot-before-stream: cached state goes out as one batched
+            // event ahead of the live delta flow the connect starts.
+            if (adapter->request_snapshot()) {
+                EVENT_LOG_INFO("Snapshot emitted by adapter: {}", adapter->name());
+            }
             EVENT_LOG_INFO("Connecting adapter: {}", adapter->name());
             adapter->connect();
         }
@@ -2,7 +2,12 @@
 
 #include "event.hpp"
 #include "data_source_adapter.hpp"
+#include <algorithm>
 #include <functional>
+#include <optional>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 #include <regex>
@@ -71,6 +76,7 @@ public:
     }
     
 protected:
+    std::vector<std::function<bool(const EventPtr&)>> compiled_filters_;
     std::vector<std::unique_ptr<EventFilter>> filters_;
 };
 
@@ -102,6 +108,119 @@ private:
     std::unique_ptr<EventFilter> filter_;
 };
 
+// Compile-time filter combinators. Each combinator is a small value type
+// exposing operator()(const EventPtr&); composing with &&, || and !
+// builds an expression-template tree the compiler collapses into one
+// inlined predicate — no unique_ptr chasing and no virtual call per node,
+// unlike an AndFilter of EventFilters. Use the runtime-polymorphic
+// EventFilter classes only when the filter shape is decided at runtime.
+//
+//   auto hot = filters::filter<DataUpdateEvent>(
+//                  [](const DataUpdateEvent& e) { return e.key == "price"; })
+//            && !filters::filter<DataUpdateEvent>(
+//                  [](const DataUpdateEvent& e) { return e.source == "test"; });
+//   pipeline.add_compiled_filter(hot);
+namespace filters {
+
+struct FilterExprTag {};
+
+template<typename Expr>
+constexpr bool is_filter_expr_v = std::is_base_of<FilterExprTag, Expr>::value;
+
+// Matches events of payload type T and applies `pred` to the payload.
+// Events of any other type fail the predicate.
+template<typename T, typename Pred>
+struct TypedPredExpr : FilterExprTag {
+    Pred pred;
+
+    bool operator()(const EventPtr& event) const {
+        if (event->type() != std::type_index(typeid(T))) {
+            return false;
+        }
+        return pred(static_cast<const TypedEvent<T>&>(*event).data());
+    }
+};
+
+template<typename T>
+struct TypeIsExpr : FilterExprTag {
+    bool operator()(const EventPtr& event) const {
+        return event->type() == std::type_index(typeid(T));
+    }
+};
+
+template<typename Pred>
+struct PredExpr : FilterExprTag {
+    Pred pred;
+
+    bool operator()(const EventPtr& event) const {
+        return pred(event);
+    }
+};
+
+template<typename L, typename R>
+struct AndExpr : FilterExprTag {
+    L lhs;
+    R rhs;
+
+    bool operator()(const EventPtr& event) const {
+        return lhs(event) && rhs(event);
+    }
+};
+
+template<typename L, typename R>
+struct OrExpr : FilterExprTag {
+    L lhs;
+    R rhs;
+
+    bool operator()(const EventPtr& event) const {
+        return lhs(event) || rhs(event);
+    }
+};
+
+template<typename E>
+struct NotExpr : FilterExprTag {
+    E expr;
+
+    bool operator()(const EventPtr& event) const {
+        return !expr(event);
+    }
+};
+
+template<typename T, typename Pred>
+auto filter(Pred pred) {
+    return TypedPredExpr<T, Pred>{{}, std::move(pred)};
+}
+
+template<typename T>
+auto type_is() {
+    return TypeIsExpr<T>{};
+}
+
+// Untyped predicate over the raw EventPtr.
+template<typename Pred>
+auto predicate(Pred pred) {
+    return PredExpr<Pred>{{}, std::move(pred)};
+}
+
+template<typename L, typename R,
+         typename = std::enable_if_t<is_filter_expr_v<L> && is_filter_expr_v<R>>>
+auto operator&&(L lhs, R rhs) {
+    return AndExpr<L, R>{{}, std::move(lhs), std::move(rhs)};
+}
+
+template<typename L, typename R,
+         typename = std::enable_if_t<is_filter_expr_v<L> && is_filter_expr_v<R>>>
+auto operator||(L lhs, R rhs) {
+    return OrExpr<L, R>{{}, std::move(lhs), std::move(rhs)};
+}
+
+template<typename E, typename = std::enable_if_t<is_filter_expr_v<E>>>
+auto operator!(E expr) {
+    return NotExpr<E>{{}, std::move(expr)};
+}
+
+} // namespace filters
+
 class EventTransformer {
 public:
     virtual ~EventTransformer() = default;
@@ -126,53 +245,152 @@ private:
     TransformFunc transform_func_;
 };
 
+// Filters and transformers registered through the typed APIs are bucketed
+// by std::type_index at registration time, so an incoming event only
+// touches the entries registered for its type and the typed downcast is a
+// single static cast (the bucket match already proved the type). Filters
+// added via add_filter() are untyped and still run for every event.
 class EventPipeline {
 public:
+    // Untyped filter: consulted for every event regardless of type.
     void add_filter(std::unique_ptr<EventFilter> filter) {
         filters_.push_back(std::move(filter));
     }
-    
+
+    // Installs a composed filter expression. The whole tree runs behind
+    // one type-erased call, versus one virtual call per node for an
+    // EventFilter composite; for zero erasure wrap the handler itself in
+    // CompiledFilterHandler instead.
+    template<typename Expr,
+             typename = std::enable_if_t<filters::is_filter_expr_v<Expr>>>
+    void add_compiled_filter(Expr expr) {
+        compiled_filters_.push_back(std::move(expr));
+    }
+
+    // Untyped transformer: offered every event, in registration order.
     void add_transformer(std::unique_ptr<EventTransformer> transformer) {
-        transformers_.push_back(std::move(transformer));
+        std::shared_ptr<EventTransformer> shared(std::move(transformer));
+        transformers_.push_back({std::nullopt, [shared](EventPtr event) {
+            return shared->transform(std::move(event));
+        }});
     }
-    
+
     EventPtr process(EventPtr event) {
+        for (const auto& filter : compiled_filters_) {
+            if (!filter(event)) {
+                return nullptr;
+            }
+        }
         for (const auto& filter : filters_) {
             if (!filter->passes(event)) {
                 return nullptr;
             }
         }
-        
-        for (const auto& transformer : transformers_) {
-            event = transformer->transform(event);
+
+        if (!allowed_types_.empty() || !typed_filters_.empty()) {
+            auto type = event->type();
+            if (!allowed_types_.empty() &&
+                std::find(allowed_types_.begin(), allowed_types_.end(), type) == allowed_types_.end()) {
+                return nullptr;
+            }
+            auto bucket = typed_filters_.find(type);
+            if (bucket != typed_filters_.end()) {
+                for (const auto& predicate : bucket->second) {
+                    if (!predicate(event)) {
+                        return nullptr;
+                    }
+                }
+            }
+        }
+
+        for (const auto& entry : transformers_) {
+            // Typed transformers are skipped with a type_index compare; no
+            // per-transformer RTTI cast.
+            if (entry.from && *entry.from != event->type()) {
+                continue;
+            }
+            event = entry.transform(std::move(event));
             if (!event) {
                 return nullptr;
             }
         }
-        
+
         return event;
     }
-    
+
+    // Restrict the pipeline to the given type. Calling this for several
+    // types builds a whitelist: an event passes if it matches any of them.
     template<typename T>
     void filter_by_type() {
-        add_filter(TypeFilter::create<T>());
+        allowed_types_.push_back(std::type_index(typeid(T)));
     }
-    
+
     template<typename T>
     void filter_by_predicate(std::function<bool(const T&)> predicate) {
-        add_filter(std::make_unique<TypedPredicateFilter<T>>(std::move(predicate)));
+        typed_filters_[std::type_index(typeid(T))].push_back(
+            [predicate = std::move(predicate)](const EventPtr& event) {
+                // Bucket lookup already matched the type; the cast is exact.
+                return predicate(std::static_pointer_cast<TypedEvent<T>>(event)->data());
+            });
     }
-    
+
     template<typename From, typename To>
     void transform(std::function<To(const From&)> transformer) {
-        add_transformer(std::make_unique<TypedEventTransformer<From, To>>(std::move(transformer)));
+        transformers_.push_back({std::type_index(typeid(From)),
+            [transformer = std::move(transformer)](EventPtr event) {
+                return make_event<To>(transformer(
+                    std::static_pointer_cast<TypedEvent<From>>(event)->data()));
+            }});
     }
-    
+
 private:
+    struct TransformerEntry {
+        std::optional<std::type_index> from;  // nullopt: offered every event
+        std::function<EventPtr(EventPtr)> transform;
+    };
+
+    std::vector<std::function<bool(const EventPtr&)>> compiled_filters_;
     std::vector<std::unique_ptr<EventFilter>> filters_;
-    std::vector<std::unique_ptr<EventTransformer>> transformers_;
+    std::vector<std::type_index> allowed_types_;
+    std::unordered_map<std::type_index, std::vector<std::function<bool(const EventPtr&)>>> typed_filters_;
+    std::vector<TransformerEntry> transformers_;
+};
+
+// Fully static counterpart to FilteredEventHandler: the filter
+// expression is a template parameter, so the predicate inlines into
+// handle() with no type erasure at all. Build with
+// make_compiled_filter_handler(expr, handler_or_callback).
+template<typename Expr>
+class CompiledFilterHandler : public EventHandler {
+public:
+    CompiledFilterHandler(Expr expr, std::shared_ptr<EventHandler> handler)
+        : expr_(std::move(expr))
+        , handler_(std::move(handler)) {}
+
+    void handle(EventPtr event) override {
+        if (expr_(event)) {
+            handler_->handle(std::move(event));
+        }
+    }
+
+private:
+    Expr expr_;
+    std::shared_ptr<EventHandler> handler_;
 };
 
+template<typename Expr>
+std::shared_ptr<EventHandler> make_compiled_filter_handler(Expr expr,
+                                                           std::shared_ptr<EventHandler> handler) {
+    return std::make_shared<CompiledFilterHandler<Expr>>(std::move(expr), std::move(handler));
+}
+
+template<typename Expr>
+std::shared_ptr<EventHandler> make_compiled_filter_handler(Expr expr,
+                                                           EventHandler::Callback callback) {
+    return make_compiled_filter_handler(std::move(expr),
+                                        std::make_shared<FunctionalEventHandler>(std::move(callback)));
+}
+
 class FilteredEventHandler : public EventHandler {
 public:
     FilteredEventHandler(std::unique_ptr<EventPipeline> pipeline, 
@@ -0,0 +1,393 @@
+#pragma once
+
+#include "event.hpp"
+#include "logging.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+
+namespace event_adapter {
+
+// Wire helpers for the journal's little-endian length-prefixed format.
+namespace journal_wire {
+
+inline void append_u32(std::string& out, std::uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+inline void append_u64(std::string& out, std::uint64_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+inline void append_string(std::string& out, std::string_view value) {
+    append_u32(out, static_cast<std::uint32_t>(value.size()));
+    out.append(value.data(), value.size());
+}
+
+// Bounds-checked sequential reader over a record payload. Throws
+// std::out_of_range on truncated input rather than reading past the map.
+class Reader {
+public:
+    explicit Reader(std::string_view data) : data_(data) {}
+
+    std::uint32_t read_u32() {
+        std::uint32_t value;
+        std::memcpy(&value, take(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    std::uint64_t read_u64() {
+        std::uint64_t value;
+        std::memcpy(&value, take(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    std::uint8_t read_u8() {
+        return static_cast<std::uint8_t>(*take(1));
+    }
+
+    std::string read_string() {
+        auto size = read_u32();
+        return std::string(take(size), size);
+    }
+
+    bool at_end() const { return offset_ == data_.size(); }
+
+private:
+    const char* take(std::size_t size) {
+        if (data_.size() - offset_ < size) {
+            throw std::out_of_range("journal record truncated");
+        }
+        const char* p = data_.data() + offset_;
+        offset_ += size;
+        return p;
+    }
+
+    std::string_view data_;
+    std::size_t offset_ = 0;
+};
+
+} // namespace journal_wire
+
+// Maps event payload types to stable wire tags with an encode and decode
+// function per type. Unregistered event types are counted and skipped by
+// the writer — the journal only ever contains records it can replay.
+class JournalCodecRegistry {
+public:
+    using Encoder = std::function<void(const Event&, std::string&)>;
+    using Decoder = std::function<EventPtr(journal_wire::Reader&)>;
+
+    // `encode` serializes a T payload into the record body; `decode`
+    // rebuilds the payload and returns it via make_event<T>.
+    template<typename T>
+    void register_event(std::uint32_t tag,
+                        std::function<void(const T&, std::string&)> encode,
+                        std::function<T(journal_wire::Reader&)> decode) {
+        encoders_[std::type_index(typeid(T))] = Entry{
+            tag,
+            [encode = std::move(encode)](const Event& event, std::string& out) {
+                encode(static_cast<const TypedEvent<T>&>(event).data(), out);
+            }};
+        decoders_[tag] = [decode = std::move(decode)](journal_wire::Reader& reader) {
+            return make_event<T>(decode(reader));
+        };
+    }
+
+    bool encode(const EventPtr& event, std::uint32_t& tag, std::string& out) const {
+        auto it = encoders_.find(event->type());
+        if (it == encoders_.end()) {
+            return false;
+        }
+        tag = it->second.tag;
+        it->second.encode(*event, out);
+        return true;
+    }
+
+    EventPtr decode(std::uint32_t tag, journal_wire::Reader& reader) const {
+        auto it = decoders_.find(tag);
+        return it == decoders_.end() ? nullptr : it->second(reader);
+    }
+
+private:
+    struct Entry {
+        std::uint32_t tag;
+        Encoder encode;
+    };
+
+    std::unordered_map<std::type_index, Entry> encoders_;
+    std::unordered_map<std::uint32_t, Decoder> decoders_;
+};
+
+namespace journal_detail {
+
+// std::any payloads are journalled for the value types the adapters
+// actually emit (string, double, int64, bool); anything else is recorded
+// as an empty any, since an arbitrary any cannot be serialized.
+inline void append_any(std::string& out, const std::any& value) {
+    if (const auto* s = std::any_cast<std::string>(&value)) {
+        out.push_back(1);
+        journal_wire::append_string(out, *s);
+    } else if (const auto* d = std::any_cast<double>(&value)) {
+        out.push_back(2);
+        std::uint64_t bits;
+        std::memcpy(&bits, d, sizeof(bits));
+        journal_wire::append_u64(out, bits);
+    } else if (const auto* i = std::any_cast<std::int64_t>(&value)) {
+        out.push_back(3);
+        journal_wire::append_u64(out, static_cast<std::uint64_t>(*i));
+    } else if (const auto* b = std::any_cast<bool>(&value)) {
+        out.push_back(4);
+        out.push_back(*b ? 1 : 0);
+    } else {
+        out.push_back(0);
+    }
+}
+
+inline std::any read_any(journal_wire::Reader& reader) {
+    switch (reader.read_u8()) {
+        case 1:
+            return reader.read_string();
+        case 2: {
+            std::uint64_t bits = reader.read_u64();
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            return d;
+        }
+        case 3:
+            return static_cast<std::int64_t>(reader.read_u64());
+        case 4:
+            return reader.read_u8() != 0;
+        default:
+            return {};
+    }
+}
+
+} // namespace journal_detail
+
+// Built-in codecs for the library's own event types. Callers with custom
+// payloads register them on top (tags below 1000 are reserved).
+inline std::shared_ptr<JournalCodecRegistry> default_journal_codecs() {
+    using namespace journal_wire;
+    auto registry = std::make_shared<JournalCodecRegistry>();
+
+    registry->register_event<DataUpdateEvent>(
+        1,
+        [](const DataUpdateEvent& e, std::string& out) {
+            append_string(out, e.source);
+            append_string(out, e.key);
+            journal_detail::append_any(out, e.value);
+            journal_detail::append_any(out, e.previous_value);
+        },
+        [](Reader& r) {
+            DataUpdateEvent e;
+            e.source = r.read_string();
+            e.key = r.read_string();
+            e.value = journal_detail::read_any(r);
+            e.previous_value = journal_detail::read_any(r);
+            return e;
+        });
+
+    registry->register_event<ConnectionEvent>(
+        2,
+        [](const ConnectionEvent& e, std::string& out) {
+            append_u32(out, static_cast<std::uint32_t>(e.type));
+            append_string(out, e.source);
+            append_string(out, e.details);
+        },
+        [](Reader& r) {
+            ConnectionEvent e;
+            e.type = static_cast<ConnectionEvent::Type>(r.read_u32());
+            e.source = r.read_string();
+            e.details = r.read_string();
+            return e;
+        });
+
+    registry->register_event<HeartbeatEvent>(
+        3,
+        [](const HeartbeatEvent& e, std::string& out) {
+            append_string(out, e.source);
+            append_u64(out, static_cast<std::uint64_t>(e.interval.count()));
+        },
+        [](Reader& r) {
+            HeartbeatEvent e;
+            e.source = r.read_string();
+            e.interval = std::chrono::milliseconds(r.read_u64());
+            return e;
+        });
+
+    registry->register_event<RawDataEvent>(
+        4,
+        [](const RawDataEvent& e, std::string& out) {
+            append_string(out, e.source);
+            append_string(out, e.key);
+            append_string(out, e.buffer.view());
+        },
+        [](Reader& r) {
+            RawDataEvent e;
+            e.source = r.read_string();
+            e.key = r.read_string();
+            e.buffer = SharedBuffer::copy_of(r.read_string());
+            return e;
+        });
+
+    registry->register_event<NumericUpdateEvent>(
+        5,
+        [](const NumericUpdateEvent& e, std::string& out) {
+            append_string(out, e.source);
+            append_string(out, e.key);
+            std::uint64_t bits;
+            std::memcpy(&bits, &e.value, sizeof(bits));
+            append_u64(out, bits);
+            std::memcpy(&bits, &e.previous_value, sizeof(bits));
+            append_u64(out, bits);
+        },
+        [](Reader& r) {
+            NumericUpdateEvent e;
+            e.source = r.read_string();
+            e.key = r.read_string();
+            std::uint64_t bits = r.read_u64();
+            std::memcpy(&e.value, &bits, sizeof(bits));
+            bits = r.read_u64();
+            std::memcpy(&e.previous_value, &bits, sizeof(bits));
+            return e;
+        });
+
+    registry->register_event<IntegerUpdateEvent>(
+        6,
+        [](const IntegerUpdateEvent& e, std::string& out) {
+            append_string(out, e.source);
+            append_string(out, e.key);
+            append_u64(out, static_cast<std::uint64_t>(e.value));
+            append_u64(out, static_cast<std::uint64_t>(e.previous_value));
+        },
+        [](Reader& r) {
+            IntegerUpdateEvent e;
+            e.source = r.read_string();
+            e.key = r.read_string();
+            e.value = static_cast<std::int64_t>(r.read_u64());
+            e.previous_value = static_cast<std::int64_t>(r.read_u64());
+            return e;
+        });
+
+    registry->register_event<StringUpdateEvent>(
+        7,
+        [](const StringUpdateEvent& e, std::string& out) {
+            append_string(out, e.source);
+            append_string(out, e.key);
+            append_string(out, e.value);
+            append_string(out, e.previous_value);
+        },
+        [](Reader& r) {
+            StringUpdateEvent e;
+            e.source = r.read_string();
+            e.key = r.read_string();
+            e.value = r.read_string();
+            e.previous_value = r.read_string();
+            return e;
+        });
+
+    return registry;
+}
+
+// Appends events to a length-prefixed binary journal with batched writes.
+// record() encodes into an in-memory batch under a mutex and only touches
+// the file when the batch passes batch_bytes, so the per-event cost is one
+// lock plus a small buffer append — cheap enough to leave on always.
+//
+// File layout: u32 magic, then per record
+//   u32 payload_len | u32 type_tag | u64 timestamp_ns | payload
+//
+// Subscribe the writer to any adapter via handler(), e.g.
+//   adapter.subscribe(journal->handler());
+class EventJournalWriter {
+public:
+    static constexpr std::uint32_t kMagic = 0x314A4145;  // "EAJ1"
+
+    explicit EventJournalWriter(const std::string& path,
+                                std::shared_ptr<JournalCodecRegistry> codecs = nullptr,
+                                std::size_t batch_bytes = 256 * 1024)
+        : codecs_(codecs ? std::move(codecs) : default_journal_codecs())
+        , batch_bytes_(batch_bytes)
+        , file_(std::fopen(path.c_str(), "wb")) {
+        if (!file_) {
+            throw std::runtime_error("EventJournalWriter: cannot open " + path);
+        }
+        journal_wire::append_u32(batch_, kMagic);
+        EVENT_LOG_INFO("EventJournalWriter recording to '{}'", path);
+    }
+
+    ~EventJournalWriter() {
+        flush();
+        if (file_) {
+            std::fclose(file_);
+        }
+    }
+
+    EventJournalWriter(const EventJournalWriter&) = delete;
+    EventJournalWriter& operator=(const EventJournalWriter&) = delete;
+
+    void record(const EventPtr& event) {
+        scratch_t scratch;
+        std::uint32_t tag = 0;
+        if (!codecs_->encode(event, tag, scratch.payload)) {
+            skipped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto timestamp_ns = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                event->timestamp().time_since_epoch()).count());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        journal_wire::append_u32(batch_, static_cast<std::uint32_t>(scratch.payload.size()));
+        journal_wire::append_u32(batch_, tag);
+        journal_wire::append_u64(batch_, timestamp_ns);
+        batch_.append(scratch.payload);
+        recorded_.fetch_add(1, std::memory_order_relaxed);
+        if (batch_.size() >= batch_bytes_) {
+            flush_locked();
+        }
+    }
+
+    // Adapter-subscribable callback; also usable as a dispatcher tap.
+    std::function<void(EventPtr)> handler() {
+        return [this](EventPtr event) { record(event); };
+    }
+
+    void flush() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        flush_locked();
+        std::fflush(file_);
+    }
+
+    std::uint64_t recorded() const { return recorded_.load(std::memory_order_relaxed); }
+    std::uint64_t skipped() const { return skipped_.load(std::memory_order_relaxed); }
+
+private:
+    struct scratch_t {
+        std::string payload;
+    };
+
+    void flush_locked() {
+        if (!batch_.empty()) {
+            std::fwrite(batch_.data(), 1, batch_.size(), file_);
+            batch_.clear();
+        }
+    }
+
+    std::shared_ptr<JournalCodecRegistry> codecs_;
+    std::size_t batch_bytes_;
+    std::FILE* file_;
+    std::mutex mutex_;
+    std::string batch_;
+    std::atomic<std::uint64_t> recorded_{0};
+    std::atomic<std::uint64_t> skipped_{0};
+};
+
+} // namespace event_adapter
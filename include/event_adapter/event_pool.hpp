@@ -0,0 +1,138 @@
+#pragma once
+
+#include "event.hpp"
+#include "logging.hpp"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace event_adapter {
+
+// Slab/pool allocator for TypedEvent<T>. Storage is carved out of large
+// slabs and recycled through a freelist, so steady-state event emission
+// does no heap allocation: std::allocate_shared places both the event and
+// its shared_ptr control block in a single pooled slot. Intended usage is
+// one pool per adapter (or per producer thread); the pool stays alive as
+// long as any event allocated from it is outstanding.
+template<typename T>
+class EventPool : public std::enable_shared_from_this<EventPool<T>> {
+public:
+    static std::shared_ptr<EventPool> create(std::size_t slab_capacity = 1024) {
+        return std::shared_ptr<EventPool>(new EventPool(slab_capacity));
+    }
+
+    template<typename... Args>
+    EventPtr make(Args&&... args) {
+        return std::allocate_shared<TypedEvent<T>>(
+            PoolAllocator<TypedEvent<T>>(this->shared_from_this()),
+            T{std::forward<Args>(args)...});
+    }
+
+    // Slots currently sitting in the freelist (diagnostic).
+    std::size_t free_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return free_slots_.size();
+    }
+
+    std::size_t slab_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return slabs_.size();
+    }
+
+private:
+    explicit EventPool(std::size_t slab_capacity) : slab_capacity_(slab_capacity) {}
+
+    void* allocate(std::size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // All allocations come from allocate_shared of the same combined
+        // object+control-block type, so the slot size is fixed after the
+        // first request.
+        if (slot_size_ == 0) {
+            slot_size_ = bytes;
+        }
+        if (bytes > slot_size_) {
+            // Shouldn't happen with a single event type per pool; fall back
+            // to the heap rather than corrupting the slab layout.
+            EVENT_LOG_WARN("EventPool slot size mismatch ({} > {}), falling back to heap", bytes, slot_size_);
+            return ::operator new(bytes);
+        }
+        if (free_slots_.empty()) {
+            grow();
+        }
+        void* slot = free_slots_.back();
+        free_slots_.pop_back();
+        return slot;
+    }
+
+    void deallocate(void* p) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!owns(p)) {
+            ::operator delete(p);
+            return;
+        }
+        free_slots_.push_back(p);
+    }
+
+    void grow() {
+        EVENT_LOG_DEBUG("EventPool growing: slab of {} slots x {} bytes", slab_capacity_, slot_size_);
+        auto slab = std::make_unique<std::byte[]>(slab_capacity_ * slot_size_);
+        for (std::size_t i = 0; i < slab_capacity_; ++i) {
+            free_slots_.push_back(slab.get() + i * slot_size_);
+        }
+        slabs_.push_back(std::move(slab));
+    }
+
+    bool owns(const void* p) const {
+        for (const auto& slab : slabs_) {
+            const std::byte* base = slab.get();
+            if (p >= base && p < base + slab_capacity_ * slot_size_) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename U>
+    struct PoolAllocator {
+        using value_type = U;
+
+        explicit PoolAllocator(std::shared_ptr<EventPool> pool) : pool_(std::move(pool)) {}
+
+        template<typename V>
+        PoolAllocator(const PoolAllocator<V>& other) : pool_(other.pool_) {}
+
+        U* allocate(std::size_t n) {
+            return static_cast<U*>(pool_->allocate(n * sizeof(U)));
+        }
+
+        void deallocate(U* p, std::size_t) {
+            pool_->deallocate(p);
+        }
+
+        template<typename V>
+        bool operator==(const PoolAllocator<V>& other) const { return pool_ == other.pool_; }
+        template<typename V>
+        bool operator!=(const PoolAllocator<V>& other) const { return pool_ != other.pool_; }
+
+        // Keeps the pool alive until the last pooled event is released.
+        std::shared_ptr<EventPool> pool_;
+    };
+
+    std::size_t slab_capacity_;
+    std::size_t slot_size_ = 0;
+    mutable std::mutex mutex_;
+    std::vector<void*> free_slots_;
+    std::vector<std::unique_ptr<std::byte[]>> slabs_;
+};
+
+// Pool-backed counterpart to make_event<T>(). Events allocated here behave
+// exactly like heap events; their storage just returns to the pool's
+// freelist on release.
+template<typename T, typename... Args>
+EventPtr make_pooled_event(EventPool<T>& pool, Args&&... args) {
+    return pool.make(std::forward<Args>(args)...);
+}
+
+} // namespace event_adapter
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "event.hpp"
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+#ifdef EVENT_ADAPTER_HAS_SIMDJSON
+#include <simdjson.h>
+#endif
+
+namespace event_adapter {
+
+using json = nlohmann::json;
+
+// Pluggable JSON parsing backend for the adapters' hot parse path.
+// Backends produce a nlohmann::json DOM so downstream consumers are
+// unaffected by which parser ran; the simdjson backend does the heavy
+// tokenizing with SIMD and only pays DOM conversion afterwards, which is
+// still several times faster than nlohmann's parser on large documents.
+class JsonParserBackend {
+public:
+    virtual ~JsonParserBackend() = default;
+
+    // Throws json::parse_error (or a backend-equivalent std::exception)
+    // on malformed input.
+    virtual json parse(std::string_view text) = 0;
+
+    virtual const char* backend_name() const = 0;
+};
+
+class NlohmannJsonParser : public JsonParserBackend {
+public:
+    json parse(std::string_view text) override {
+        return json::parse(text);
+    }
+
+    const char* backend_name() const override { return "nlohmann"; }
+};
+
+#ifdef EVENT_ADAPTER_HAS_SIMDJSON
+class SimdJsonParser : public JsonParserBackend {
+public:
+    json parse(std::string_view text) override {
+        // dom::parser reuses internal buffers and is not thread-safe, so
+        // each thread gets its own instance; the shared backend object
+        // (including the process-wide default) is then safe to call from
+        // any number of adapter threads, and each thread still keeps the
+        // buffer-reuse win across calls.
+        thread_local simdjson::dom::parser parser;
+        simdjson::dom::element root = parser.parse(text.data(), text.size());
+        return convert(root);
+    }
+
+    const char* backend_name() const override { return "simdjson"; }
+
+private:
+    static json convert(const simdjson::dom::element& element) {
+        switch (element.type()) {
+            case simdjson::dom::element_type::ARRAY: {
+                json array = json::array();
+                for (simdjson::dom::element child : simdjson::dom::array(element)) {
+                    array.push_back(convert(child));
+                }
+                return array;
+            }
+            case simdjson::dom::element_type::OBJECT: {
+                json object = json::object();
+                for (simdjson::dom::key_value_pair field : simdjson::dom::object(element)) {
+                    object[std::string(field.key)] = convert(field.value);
+                }
+                return object;
+            }
+            case simdjson::dom::element_type::INT64:
+                return json(int64_t(element));
+            case simdjson::dom::element_type::UINT64:
+                return json(uint64_t(element));
+            case simdjson::dom::element_type::DOUBLE:
+                return json(double(element));
+            case simdjson::dom::element_type::STRING:
+                return json(std::string(std::string_view(element)));
+            case simdjson::dom::element_type::BOOL:
+                return json(bool(element));
+            case simdjson::dom::element_type::NULL_VALUE:
+            default:
+                return json(nullptr);
+        }
+    }
+};
+#endif // EVENT_ADAPTER_HAS_SIMDJSON
+
+// The process-wide default backend (simdjson when built with it).
+inline std::shared_ptr<JsonParserBackend> default_json_parser() {
+#ifdef EVENT_ADAPTER_HAS_SIMDJSON
+    static auto parser = std::make_shared<SimdJsonParser>();
+#else
+    static auto parser = std::make_shared<NlohmannJsonParser>();
+#endif
+    return parser;
+}
+
+// Lazily-parsed JSON payload: carries the raw bytes (shared, zero-copy)
+// and only materializes the DOM on first dom() access, so handlers that
+// never touch the document — or only forward it — pay nothing, and
+// handlers that read it parse exactly once. Copies share the parse state.
+class LazyJsonDocument {
+public:
+    LazyJsonDocument() = default;
+
+    LazyJsonDocument(SharedBuffer raw, std::shared_ptr<JsonParserBackend> backend)
+        : state_(std::make_shared<State>()) {
+        state_->raw = std::move(raw);
+        state_->backend = std::move(backend);
+    }
+
+    std::string_view raw() const {
+        return state_ ? state_->raw.view() : std::string_view{};
+    }
+
+    bool parsed() const {
+        return state_ && state_->dom.has_value();
+    }
+
+    // Parses on first call (throws on malformed input); cached afterwards.
+    // Throws on a default-constructed document, which has no buffer.
+    const json& dom() const {
+        if (!state_) {
+            throw std::runtime_error("LazyJsonDocument: no buffer attached");
+        }
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (!state_->dom) {
+            auto backend = state_->backend ? state_->backend : default_json_parser();
+            state_->dom = backend->parse(state_->raw.view());
+        }
+        return *state_->dom;
+    }
+
+private:
+    struct State {
+        SharedBuffer raw;
+        std::shared_ptr<JsonParserBackend> backend;
+        std::mutex mutex;
+        std::optional<json> dom;
+    };
+
+    std::shared_ptr<State> state_;
+};
+
+} // namespace event_adapter
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace event_adapter {
+
+// Bounded lock-free multi-producer/single-consumer ring buffer.
+// Capacity is rounded up to a power of two; each cell carries a sequence
+// number (Vyukov-style) so producers can claim slots with a single
+// fetch_add and the consumer never touches a mutex on the hot path.
+template<typename T>
+class MpscRingQueue {
+public:
+    explicit MpscRingQueue(std::size_t capacity)
+        : capacity_(round_up_pow2(capacity))
+        , mask_(capacity_ - 1)
+        , cells_(new Cell[capacity_]) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        head_.value.store(0, std::memory_order_relaxed);
+        tail_.value.store(0, std::memory_order_relaxed);
+    }
+
+    MpscRingQueue(const MpscRingQueue&) = delete;
+    MpscRingQueue& operator=(const MpscRingQueue&) = delete;
+
+    // Multi-producer push. Returns false when the ring is full, leaving
+    // `item` intact so callers can retry (nothing is moved from until a
+    // slot has been claimed).
+    bool try_push(T&& item) {
+        Cell* cell;
+        std::size_t pos = tail_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = tail_.value.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(item);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Single-consumer pop. Returns false when the ring is empty.
+    bool try_pop(T& out) {
+        std::size_t pos = head_.value.load(std::memory_order_relaxed);
+        Cell* cell = &cells_[pos & mask_];
+        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+        if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1) < 0) {
+            return false;  // empty
+        }
+        out = std::move(cell->data);
+        cell->data = T{};
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        head_.value.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Approximate size; exact only when producers and consumer are quiescent.
+    std::size_t size_approx() const {
+        std::size_t tail = tail_.value.load(std::memory_order_relaxed);
+        std::size_t head = head_.value.load(std::memory_order_relaxed);
+        return tail >= head ? tail - head : 0;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    // Keep the producer- and consumer-owned indices on separate cache lines
+    // so producers don't invalidate the consumer's line and vice versa.
+    struct alignas(kCacheLineSize) PaddedIndex {
+        std::atomic<std::size_t> value;
+        char padding[kCacheLineSize - sizeof(std::atomic<std::size_t>)];
+    };
+
+    static std::size_t round_up_pow2(std::size_t n) {
+        std::size_t p = 1;
+        while (p < n) {
+            p <<= 1;
+        }
+        return p < 2 ? 2 : p;
+    }
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    PaddedIndex head_;  // consumer side
+    PaddedIndex tail_;  // producer side
+};
+
+} // namespace event_adapter
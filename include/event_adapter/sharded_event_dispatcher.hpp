@@ -0,0 +1,192 @@
+#pragma once
+
+#include "event.hpp"
+#include "logging.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace event_adapter {
+
+// Worker-pool dispatcher: events are sharded across N consumer threads by
+// a per-type key extractor (e.g. DataUpdateEvent::source), so events with
+// the same key are always processed in order on the same thread while
+// different keys scale across cores. Registration mirrors EventDispatcher,
+// and the class exposes the same dispatch()/start()/stop() surface so it
+// plugs into EventAdapterSystem unchanged. Processors for different shards
+// run concurrently against the shared state machine, so they must be safe
+// to invoke from multiple threads.
+template<typename StateMachine>
+class ShardedEventDispatcher {
+public:
+    using EventProcessor = std::function<void(EventPtr, StateMachine&)>;
+
+    ShardedEventDispatcher(StateMachine& sm, std::size_t num_shards)
+        : state_machine_(sm)
+        , running_(false)
+        , shards_(num_shards == 0 ? 1 : num_shards) {
+        EVENT_LOG_DEBUG("ShardedEventDispatcher created with {} shards", shards_.size());
+        for (auto& shard : shards_) {
+            shard = std::make_unique<Shard>();
+        }
+    }
+
+    ~ShardedEventDispatcher() {
+        stop();
+    }
+
+    template<typename EventType>
+    void register_event_processor(std::function<void(const EventType&, StateMachine&)> processor) {
+        EVENT_LOG_DEBUG("Registering event processor for type: {}", typeid(EventType).name());
+        processors_[std::type_index(typeid(EventType))] = [processor](EventPtr event, StateMachine& sm) {
+            if (auto typed_event = std::dynamic_pointer_cast<TypedEvent<EventType>>(event)) {
+                processor(typed_event->data(), sm);
+            }
+        };
+    }
+
+    template<typename EventType, typename SMEvent>
+    void register_event_mapping(std::function<SMEvent(const EventType&)> converter) {
+        register_event_processor<EventType>([converter](const EventType& event, StateMachine& sm) {
+            sm.process_event(converter(event));
+        });
+    }
+
+    template<typename EventType>
+    void register_direct_mapping() {
+        register_event_processor<EventType>([](const EventType& event, StateMachine& sm) {
+            sm.process_event(event);
+        });
+    }
+
+    // Events of EventType are routed to shard hash(key) % N. Types without
+    // a registered key all land on shard 0, which keeps their relative
+    // ordering intact.
+    template<typename EventType>
+    void register_shard_key(std::function<std::string(const EventType&)> key_of) {
+        key_extractors_[std::type_index(typeid(EventType))] = [key_of](const EventPtr& event) -> std::size_t {
+            if (auto typed_event = std::dynamic_pointer_cast<TypedEvent<EventType>>(event)) {
+                return std::hash<std::string>{}(key_of(typed_event->data()));
+            }
+            return 0;
+        };
+    }
+
+    void dispatch(EventPtr event) {
+        auto& shard = *shards_[shard_index(event)];
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.queue.push(std::move(event));
+        }
+        shard.cv.notify_one();
+    }
+
+    void start() {
+        EVENT_LOG_INFO("Starting ShardedEventDispatcher with {} workers", shards_.size());
+        running_ = true;
+        for (std::size_t i = 0; i < shards_.size(); ++i) {
+            shards_[i]->thread = std::thread([this, i]() {
+                process_events(*shards_[i], i);
+            });
+        }
+    }
+
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        EVENT_LOG_INFO("Stopping ShardedEventDispatcher");
+        for (auto& shard : shards_) {
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+            }
+            shard->cv.notify_all();
+        }
+        for (auto& shard : shards_) {
+            if (shard->thread.joinable()) {
+                shard->thread.join();
+            }
+        }
+        EVENT_LOG_INFO("ShardedEventDispatcher stopped");
+    }
+
+    std::size_t shard_count() const { return shards_.size(); }
+
+    size_t queue_size() const {
+        size_t total = 0;
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            total += shard->queue.size();
+        }
+        return total;
+    }
+
+private:
+    struct Shard {
+        mutable std::mutex mutex;
+        std::condition_variable cv;
+        std::queue<EventPtr> queue;
+        std::thread thread;
+    };
+
+    std::size_t shard_index(const EventPtr& event) const {
+        auto it = key_extractors_.find(event->type());
+        if (it == key_extractors_.end()) {
+            return 0;
+        }
+        return it->second(event) % shards_.size();
+    }
+
+    void process_events(Shard& shard, std::size_t index) {
+        EVENT_LOG_DEBUG("Shard {} worker thread started", index);
+        std::queue<EventPtr> batch;
+        while (running_) {
+            {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                shard.cv.wait(lock, [this, &shard]() { return !shard.queue.empty() || !running_; });
+                batch.swap(shard.queue);
+            }
+            drain(batch);
+        }
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        batch.swap(shard.queue);
+        lock.unlock();
+        drain(batch);
+        EVENT_LOG_DEBUG("Shard {} worker thread exiting", index);
+    }
+
+    void drain(std::queue<EventPtr>& batch) {
+        while (!batch.empty()) {
+            process_event(batch.front());
+            batch.pop();
+        }
+    }
+
+    void process_event(EventPtr event) {
+        auto it = processors_.find(event->type());
+        if (it != processors_.end()) {
+            try {
+                it->second(event, state_machine_);
+            } catch (const std::exception& e) {
+                EVENT_LOG_ERROR("Exception processing event {}: {}", event->type().name(), e.what());
+            }
+        } else {
+            EVENT_LOG_WARN("No processor registered for event type: {}", event->type().name());
+        }
+    }
+
+    StateMachine& state_machine_;
+    std::unordered_map<std::type_index, EventProcessor> processors_;
+    std::unordered_map<std::type_index, std::function<std::size_t(const EventPtr&)>> key_extractors_;
+    std::atomic<bool> running_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace event_adapter
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "event.hpp"
+#include "logging.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <variant>
+
+namespace event_adapter {
+
+// Compile-time typed dispatcher for a closed event set. Events are stored
+// by value in an EventVariant and delivered to the state machine through
+// std::visit — no type_index hash lookup, no dynamic_pointer_cast, and no
+// shared_ptr allocation per event. Use this when the full event set is
+// known at compile time (the same set you would hand to
+// SmlEventDispatcher::auto_register_all<Events...>()); fall back to
+// EventDispatcher when event types are only known at runtime.
+template<typename StateMachine, typename... Events>
+class StaticEventDispatcher {
+public:
+    using Variant = EventVariant<Events...>;
+
+    explicit StaticEventDispatcher(StateMachine& sm) : state_machine_(sm), running_(false) {
+        EVENT_LOG_DEBUG("StaticEventDispatcher created for {} event types", sizeof...(Events));
+    }
+
+    ~StaticEventDispatcher() {
+        stop();
+    }
+
+    template<typename EventType>
+    void dispatch(EventType event) {
+        static_assert((std::is_same_v<EventType, Events> || ...),
+                      "EventType is not part of this dispatcher's event set");
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            event_queue_.emplace(std::move(event));
+        }
+        queue_cv_.notify_one();
+    }
+
+    void start() {
+        EVENT_LOG_INFO("Starting StaticEventDispatcher");
+        running_ = true;
+        processor_thread_ = std::thread([this]() {
+            process_events();
+        });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            if (!running_) {
+                return;
+            }
+            running_ = false;
+        }
+        queue_cv_.notify_all();
+        if (processor_thread_.joinable()) {
+            processor_thread_.join();
+        }
+        EVENT_LOG_INFO("StaticEventDispatcher stopped");
+    }
+
+    size_t queue_size() const {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        return event_queue_.size();
+    }
+
+private:
+    void process_events() {
+        EVENT_LOG_DEBUG("Static event processing thread started");
+        std::queue<Variant> batch;
+        while (running_) {
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                queue_cv_.wait(lock, [this]() { return !event_queue_.empty() || !running_; });
+                batch.swap(event_queue_);
+            }
+            drain(batch);
+        }
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        batch.swap(event_queue_);
+        lock.unlock();
+        drain(batch);
+        EVENT_LOG_DEBUG("Static event processing thread exiting");
+    }
+
+    void drain(std::queue<Variant>& batch) {
+        while (!batch.empty()) {
+            std::visit([this](auto& event) {
+                try {
+                    state_machine_.process_event(event);
+                } catch (const std::exception& e) {
+                    EVENT_LOG_ERROR("Exception processing event {}: {}",
+                                    typeid(std::decay_t<decltype(event)>).name(), e.what());
+                }
+            }, batch.front());
+            batch.pop();
+        }
+    }
+
+    StateMachine& state_machine_;
+    mutable std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::queue<Variant> event_queue_;
+    std::atomic<bool> running_;
+    std::thread processor_thread_;
+};
+
+} // namespace event_adapter
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "logging.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace event_adapter {
+
+// Shared timer service that multiplexes many periodic callbacks onto one
+// thread, replacing the one-sleeping-thread-per-poller model. Timers are
+// hashed into a wheel of fixed-resolution slots; intervals beyond one
+// revolution carry a remaining-rounds count, which gives the hierarchical
+// behaviour (arbitrary horizons) with a single wheel. The worker ticks on
+// absolute deadlines (sleep_until), so drift stays bounded by slot
+// resolution instead of accumulating per tick.
+//
+// Callbacks run on the wheel thread outside the wheel lock; a slow
+// callback delays later timers of the same tick but cannot deadlock
+// against schedule/cancel. cancel() blocks until a concurrently running
+// callback has returned, so it is safe to destroy the callback's target
+// right after cancelling (unless called from the callback itself).
+class TimerWheelService {
+public:
+    using TimerId = std::uint64_t;
+
+    explicit TimerWheelService(std::chrono::milliseconds resolution = std::chrono::milliseconds(10),
+                               std::size_t slot_count = 256)
+        : resolution_(resolution)
+        , slots_(slot_count) {}
+
+    ~TimerWheelService() {
+        stop();
+    }
+
+    void start() {
+        bool expected = false;
+        if (!running_.compare_exchange_strong(expected, true)) {
+            return;
+        }
+        EVENT_LOG_INFO("TimerWheelService starting ({}ms resolution, {} slots)",
+                       resolution_.count(), slots_.size());
+        worker_ = std::thread([this]() { run(); });
+    }
+
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cv_.notify_all();
+        }
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+        EVENT_LOG_INFO("TimerWheelService stopped");
+    }
+
+    // Schedules `callback` every `interval` (rounded up to wheel
+    // resolution), first firing one interval from now. Starts the worker
+    // thread on first use.
+    TimerId schedule_periodic(std::chrono::milliseconds interval, std::function<void()> callback) {
+        start();
+        auto timer = std::make_shared<Timer>();
+        timer->id = next_id_.fetch_add(1, std::memory_order_relaxed);
+        timer->interval_ticks = ticks_for(interval);
+        timer->callback = std::move(callback);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            timers_[timer->id] = timer;
+            insert_locked(timer, timer->interval_ticks);
+        }
+        return timer->id;
+    }
+
+    // After cancel() returns the callback is not running and will not run
+    // again. Must not be called from within the callback itself.
+    void cancel(TimerId id) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = timers_.find(id);
+        if (it == timers_.end()) {
+            return;
+        }
+        it->second->cancelled = true;
+        timers_.erase(it);
+        cv_.wait(lock, [this, id]() { return running_callback_ != id; });
+    }
+
+    std::size_t active_timers() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return timers_.size();
+    }
+
+private:
+    struct Timer {
+        TimerId id = 0;
+        std::uint64_t interval_ticks = 1;
+        std::uint64_t remaining_rounds = 0;
+        std::function<void()> callback;
+        bool cancelled = false;
+    };
+    using TimerPtr = std::shared_ptr<Timer>;
+
+    std::uint64_t ticks_for(std::chrono::milliseconds interval) const {
+        auto ticks = (interval + resolution_ - std::chrono::milliseconds(1)) / resolution_;
+        return ticks < 1 ? 1 : static_cast<std::uint64_t>(ticks);
+    }
+
+    void insert_locked(const TimerPtr& timer, std::uint64_t ticks_from_now) {
+        std::size_t slot = (cursor_ + ticks_from_now) % slots_.size();
+        timer->remaining_rounds = ticks_from_now / slots_.size();
+        slots_[slot].push_back(timer);
+    }
+
+    void run() {
+        auto next_tick = std::chrono::steady_clock::now() + resolution_;
+        std::vector<TimerPtr> due;
+        while (running_.load()) {
+            std::this_thread::sleep_until(next_tick);
+            next_tick += resolution_;
+
+            due.clear();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                cursor_ = (cursor_ + 1) % slots_.size();
+                auto& slot = slots_[cursor_];
+                std::size_t kept = 0;
+                for (auto& timer : slot) {
+                    if (timer->cancelled) {
+                        continue;
+                    }
+                    if (timer->remaining_rounds > 0) {
+                        --timer->remaining_rounds;
+                        slot[kept++] = std::move(timer);
+                    } else {
+                        due.push_back(std::move(timer));
+                    }
+                }
+                slot.resize(kept);
+            }
+
+            for (auto& timer : due) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (timer->cancelled) {
+                        continue;
+                    }
+                    running_callback_ = timer->id;
+                }
+                try {
+                    timer->callback();
+                } catch (const std::exception& e) {
+                    EVENT_LOG_ERROR("TimerWheelService callback error: {}", e.what());
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    running_callback_ = 0;
+                    cv_.notify_all();
+                    if (!timer->cancelled) {
+                        insert_locked(timer, timer->interval_ticks);
+                    }
+                }
+            }
+
+            // If callbacks overran the tick, resynchronize instead of
+            // firing a burst of catch-up ticks.
+            auto now = std::chrono::steady_clock::now();
+            if (next_tick < now) {
+                next_tick = now + resolution_;
+            }
+        }
+    }
+
+    std::chrono::milliseconds resolution_;
+    std::vector<std::vector<TimerPtr>> slots_;
+    std::size_t cursor_ = 0;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<TimerId, TimerPtr> timers_;
+    TimerId running_callback_ = 0;
+    std::atomic<TimerId> next_id_{1};
+    std::atomic<bool> running_{false};
+    std::thread worker_;
+};
+
+} // namespace event_adapter